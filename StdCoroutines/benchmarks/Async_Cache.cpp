@@ -0,0 +1,173 @@
+/**============================================================================
+Name        : Async_Cache.cpp
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : AsyncCache under Zipfian keys: hit path cost, hit ratio and tail latency with misses
+============================================================================**/
+
+#include "Benchmarks.h"
+#include "runtime/AsyncCache.h"
+#include "runtime/Task.h"
+#include "runtime/TimerService.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <format>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+    using namespace StdCoroutines::Runtime;
+    using namespace std::chrono_literals;
+    using StdCoroutines::Benchmarks::Suite;
+
+    constexpr size_t keysCount { 100'000 };
+    constexpr size_t workersCount { 64 };
+    constexpr size_t requestsPerWorker { 4'000 };
+    constexpr double zipfSkew { 0.99 };
+
+    /** Key ranks drawn from a precomputed CDF: rank 0 is the hottest key **/
+    class Zipf
+    {
+        std::vector<double> cdf;
+
+    public:
+
+        Zipf(const size_t count, const double skew): cdf(count)
+        {
+            double sum { 0 };
+            for (size_t rank = 0; rank < count; ++rank) {
+                sum += 1.0 / std::pow(static_cast<double>(rank + 1), skew);
+                cdf[rank] = sum;
+            }
+            for (double& value: cdf) {
+                value /= sum;
+            }
+        }
+
+        [[nodiscard]]
+        size_t operator()(std::mt19937_64& engine) const
+        {
+            const double point = std::uniform_real_distribution<double> { 0.0, 1.0 }(engine);
+            const auto iter = std::lower_bound(cdf.begin(), cdf.end(), point);
+            return std::min<size_t>(iter - cdf.begin(), cdf.size() - 1);
+        }
+    };
+
+    /** A backend round trip: the value is derived from the key **/
+    Task<uint64_t> loadFromBackend(const std::string& key)
+    {
+        co_await sleep_for(100us);
+        co_return std::hash<std::string> {}(key);
+    }
+
+    Task<> worker(ThreadPool& pool,
+                  AsyncCache<uint64_t>& cache,
+                  const std::vector<std::string>& keys,
+                  const std::vector<uint32_t>& ranks,
+                  std::vector<std::chrono::nanoseconds>& latencies)
+    {
+        co_await pool.schedule();
+        for (const uint32_t rank: ranks)
+        {
+            const auto start = Clock::now();
+            const uint64_t value = co_await cache.get_or_load(keys[rank], &loadFromBackend);
+            latencies.push_back(Clock::now() - start);
+            StdCoroutines::Benchmarks::doNotOptimize(value);
+        }
+    }
+
+    void runZipf(Suite& suite,
+                 const std::string& name,
+                 const std::vector<std::string>& keys,
+                 const Zipf& zipf,
+                 const size_t capacity,
+                 const bool warmUp)
+    {
+        if (!suite.enabled(name)) {
+            return;
+        }
+
+        ThreadPool& pool = ThreadPool::shared();
+        AsyncCache<uint64_t> cache { capacity };
+        if (warmUp)
+        {
+            std::vector<Task<>> loads;
+            std::vector<std::chrono::nanoseconds> ignored;
+            std::vector<uint32_t> all(keys.size());
+            for (uint32_t rank = 0; rank < all.size(); ++rank) {
+                all[rank] = rank;
+            }
+            loads.push_back(worker(pool, cache, keys, all, ignored));
+            syncWait(whenAll(std::move(loads)));
+        }
+        const auto before = cache.stats();
+
+        std::mt19937_64 engine { 42 };
+        std::vector<std::vector<uint32_t>> ranks(workersCount, std::vector<uint32_t>(requestsPerWorker));
+        for (std::vector<uint32_t>& sequence: ranks) {
+            for (uint32_t& rank: sequence) {
+                rank = static_cast<uint32_t>(zipf(engine));
+            }
+        }
+        std::vector<std::vector<std::chrono::nanoseconds>> latencies(workersCount);
+        std::vector<Task<>> workers;
+        for (size_t idx = 0; idx < workersCount; ++idx) {
+            latencies[idx].reserve(requestsPerWorker);
+            workers.push_back(worker(pool, cache, keys, ranks[idx], latencies[idx]));
+        }
+
+        const auto start = Clock::now();
+        syncWait(whenAll(std::move(workers)));
+        const std::chrono::nanoseconds elapsed = Clock::now() - start;
+
+        std::vector<std::chrono::nanoseconds> all;
+        all.reserve(workersCount * requestsPerWorker);
+        for (const auto& perWorker: latencies) {
+            all.insert(all.end(), perWorker.begin(), perWorker.end());
+        }
+        std::ranges::sort(all);
+        const auto micros = [](const std::chrono::nanoseconds value) {
+            return static_cast<double>(value.count()) / 1e3;
+        };
+
+        const auto after = cache.stats();
+        const double requests = static_cast<double>(all.size());
+        StdCoroutines::Benchmarks::Result result;
+        result.name = name;
+        result.operations = all.size();
+        result.nsPerOp = static_cast<double>(elapsed.count()) / requests;
+        result.extra["requests_per_sec"] = requests * 1e9 / static_cast<double>(elapsed.count());
+        result.extra["hit_ratio"] = static_cast<double>(after.hits - before.hits) / requests;
+        result.extra["loads"] = static_cast<double>(after.misses - before.misses);
+        result.extra["joined_loads"] = static_cast<double>(after.joins - before.joins);
+        result.extra["evictions"] = static_cast<double>(after.evictions - before.evictions);
+        result.extra["p50_us"] = micros(all[all.size() / 2]);
+        result.extra["p99_us"] = micros(all[all.size() * 99 / 100]);
+        result.extra["p999_us"] = micros(all[all.size() * 999 / 1000]);
+        result.extra["max_us"] = micros(all.back());
+        suite.add(std::move(result));
+    }
+}
+
+void StdCoroutines::Benchmarks::Async_Cache::Run(Suite& suite)
+{
+    std::vector<std::string> keys(keysCount);
+    for (size_t idx = 0; idx < keysCount; ++idx) {
+        keys[idx] = std::format("user:{:08}", idx);
+    }
+    const Zipf zipf { keysCount, zipfSkew };
+
+    /** Everything cached: only the hit path (shard lock, probe, CLOCK bit, copy out).
+     *  Twice the key space, as the keys do not spread over the shards perfectly evenly **/
+    runZipf(suite, "async_cache/zipf_hits_only", keys, zipf, 2 * keysCount, true);
+
+    /** 10% of the key space fits: misses go to a 100us backend, concurrent ones share a load **/
+    runZipf(suite, "async_cache/zipf_capacity_10pct", keys, zipf, keysCount / 10, false);
+}
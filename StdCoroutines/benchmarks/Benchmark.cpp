@@ -0,0 +1,224 @@
+/**============================================================================
+Name        : Benchmark.cpp
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Minimal benchmark harness: ns/op, allocations/op, perf counters
+============================================================================**/
+
+#include "Benchmark.h"
+#include "runtime/AllocationHook.h"
+
+#include <algorithm>
+#include <format>
+#include <print>
+
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace
+{
+    int openCounter(const uint32_t type, const uint64_t config, const int groupFd)
+    {
+        perf_event_attr attr {};
+        attr.size = sizeof(attr);
+        attr.type = type;
+        attr.config = config;
+        attr.disabled = (-1 == groupFd) ? 1 : 0;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_GROUP;
+        return static_cast<int>(::syscall(__NR_perf_event_open, &attr, 0, -1, groupFd, 0));
+    }
+}
+
+namespace StdCoroutines::Benchmarks
+{
+    PerfCounters::PerfCounters()
+    {
+        constexpr std::pair<uint32_t, uint64_t> events[] {
+            { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+            { PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+            { PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES },
+            { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES },
+        };
+
+        for (size_t idx = 0; idx < std::size(events); ++idx)
+        {
+            fds[idx] = openCounter(events[idx].first, events[idx].second, groupFd);
+            if (fds[idx] < 0) {
+                close();
+                return;
+            }
+            if (0 == idx) {
+                groupFd = fds[0];
+            }
+        }
+    }
+
+    PerfCounters::~PerfCounters()
+    {
+        close();
+    }
+
+    void PerfCounters::close() noexcept
+    {
+        for (int& fd: fds) {
+            if (fd >= 0)
+                ::close(fd);
+            fd = -1;
+        }
+        groupFd = -1;
+    }
+
+    void PerfCounters::start() noexcept
+    {
+        if (available()) {
+            ::ioctl(groupFd, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+            ::ioctl(groupFd, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+        }
+    }
+
+    Counters PerfCounters::stop() noexcept
+    {
+        if (!available()) {
+            return {};
+        }
+        ::ioctl(groupFd, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+
+        uint64_t values[1 + std::size(fds)] {};
+        if (::read(groupFd, values, sizeof(values)) != static_cast<ssize_t>(sizeof(values))) {
+            return {};
+        }
+        return Counters { static_cast<double>(values[1]), static_cast<double>(values[2]),
+                          static_cast<double>(values[3]), static_cast<double>(values[4]) };
+    }
+
+    Suite::Suite(const std::string_view nameFilter): filter { nameFilter } {
+    }
+
+    bool Suite::enabled(const std::string_view name) const {
+        return filter.empty() || name.find(filter) != std::string_view::npos;
+    }
+
+    void Suite::run(const std::string_view name, const std::function<void(uint64_t)>& fn)
+    {
+        if (!enabled(name)) {
+            return;
+        }
+
+        /** Calibrate: grow the batch until a single run takes at least minTime **/
+        uint64_t operations { 1 };
+        while (true)
+        {
+            const auto start = std::chrono::steady_clock::now();
+            fn(operations);
+            const auto elapsed = std::chrono::steady_clock::now() - start;
+            if (elapsed >= minTime || operations >= (uint64_t { 1 } << 34)) {
+                break;
+            }
+            const double factor = elapsed.count() > 0 ? 1.4 * minTime / elapsed : 100.0;
+            operations = static_cast<uint64_t>(static_cast<double>(operations) * std::clamp(factor, 2.0, 100.0));
+        }
+
+        PerfCounters perf;
+        const Runtime::Allocations::Stats before = Runtime::Allocations::global();
+        perf.start();
+        const auto start = std::chrono::steady_clock::now();
+        fn(operations);
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        const Counters counters = perf.stop();
+        const Runtime::Allocations::Stats after = Runtime::Allocations::global();
+
+        const auto ops = static_cast<double>(operations);
+        Result result;
+        result.name = std::string { name };
+        result.operations = operations;
+        result.nsPerOp = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()) / ops;
+        result.allocationsPerOp = static_cast<double>(after.count - before.count) / ops;
+        result.bytesPerOp = static_cast<double>(after.bytes - before.bytes) / ops;
+        if (perf.available()) {
+            result.counters = Counters { counters.cycles / ops, counters.instructions / ops,
+                                         counters.branchMisses / ops, counters.cacheMisses / ops };
+        }
+        add(std::move(result));
+    }
+
+    void Suite::add(Result result)
+    {
+        std::println(stderr, "  {:<48} {:>12.2f} ns/op", result.name, result.nsPerOp);
+        results.push_back(std::move(result));
+    }
+
+    void Suite::printTable() const
+    {
+        std::println("{:<48} {:>14} {:>12} {:>10} {:>10} {:>10} {:>10}",
+                     "benchmark", "ops", "ns/op", "allocs/op", "cycles/op", "instr/op", "br-miss/op");
+        for (const Result& result: results)
+        {
+            std::print("{:<48} {:>14} {:>12.2f} {:>10.3f}",
+                       result.name, result.operations, result.nsPerOp, result.allocationsPerOp);
+            if (result.counters) {
+                std::print(" {:>10.1f} {:>10.1f} {:>10.3f}",
+                           result.counters->cycles, result.counters->instructions, result.counters->branchMisses);
+            } else {
+                std::print(" {:>10} {:>10} {:>10}", "-", "-", "-");
+            }
+            for (const auto& [key, value]: result.extra)
+                std::print("  {}={:.2f}", key, value);
+            std::println("");
+        }
+    }
+
+    void Suite::printJson() const
+    {
+        std::println("{{\n  \"benchmarks\": [");
+        for (size_t idx = 0; idx < results.size(); ++idx)
+        {
+            const Result& result = results[idx];
+            std::print("    {{\"name\": \"{}\", \"operations\": {}, \"ns_per_op\": {:.3f}, "
+                       "\"allocations_per_op\": {:.4f}, \"bytes_per_op\": {:.2f}",
+                       result.name, result.operations, result.nsPerOp, result.allocationsPerOp, result.bytesPerOp);
+            if (result.counters) {
+                std::print(", \"cycles_per_op\": {:.2f}, \"instructions_per_op\": {:.2f}, "
+                           "\"branch_misses_per_op\": {:.4f}, \"cache_misses_per_op\": {:.4f}",
+                           result.counters->cycles, result.counters->instructions,
+                           result.counters->branchMisses, result.counters->cacheMisses);
+            } else {
+                std::print(", \"perf_counters\": null");
+            }
+            for (const auto& [key, value]: result.extra)
+                std::print(", \"{}\": {:.3f}", key, value);
+            std::println("}}{}", idx + 1 < results.size() ? "," : "");
+        }
+        std::println("  ]\n}}");
+    }
+
+    void Suite::printComparison(const std::string_view baseline, const std::string_view candidate) const
+    {
+        const auto find = [this](const std::string& name) -> const Result* {
+            const auto iter = std::ranges::find(results, name, &Result::name);
+            return results.end() == iter ? nullptr : &*iter;
+        };
+
+        std::println("\n{:<32} {:>16} {:>16} {:>10}", "workload",
+                     std::format("{} ns/op", baseline), std::format("{} ns/op", candidate), "speedup");
+        const std::string suffix = std::format("/{}", baseline);
+        for (const Result& result: results)
+        {
+            if (!result.name.ends_with(suffix)) {
+                continue;
+            }
+            const std::string workload = result.name.substr(0, result.name.size() - suffix.size());
+            const Result* const other = find(std::format("{}/{}", workload, candidate));
+            if (!other) {
+                continue;
+            }
+            std::println("{:<32} {:>16.1f} {:>16.1f} {:>9.2f}x",
+                         workload, result.nsPerOp, other->nsPerOp, result.nsPerOp / other->nsPerOp);
+        }
+    }
+}
@@ -0,0 +1,106 @@
+/**============================================================================
+Name        : Benchmark.h
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Minimal benchmark harness: ns/op, allocations/op, perf counters
+============================================================================**/
+
+#ifndef CPPCOROUTINES_BENCHMARK_H
+#define CPPCOROUTINES_BENCHMARK_H
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace StdCoroutines::Benchmarks
+{
+    template<typename T>
+    inline void doNotOptimize(T const& value) {
+        asm volatile("" : : "r,m"(value) : "memory");
+    }
+
+    struct Counters
+    {
+        double cycles { 0 };
+        double instructions { 0 };
+        double branchMisses { 0 };
+        double cacheMisses { 0 };
+    };
+
+    struct Result
+    {
+        std::string name;
+        uint64_t operations { 0 };
+        double nsPerOp { 0 };
+        double allocationsPerOp { 0 };
+        double bytesPerOp { 0 };
+
+        /** Values are per operation. Empty when perf_event_open is not permitted **/
+        std::optional<Counters> counters;
+
+        /** Benchmark specific metrics (throughput, latency percentiles, ...) **/
+        std::map<std::string, double> extra;
+    };
+
+    /** Hardware counters of the calling thread (cycles, instructions, branch-misses, cache-misses) **/
+    class PerfCounters
+    {
+        int groupFd { -1 };
+        int fds[4] { -1, -1, -1, -1 };
+
+        void close() noexcept;
+
+    public:
+
+        PerfCounters();
+        ~PerfCounters();
+
+        PerfCounters(const PerfCounters&) = delete;
+        PerfCounters& operator=(const PerfCounters&) = delete;
+
+        [[nodiscard]]
+        bool available() const noexcept {
+            return groupFd >= 0;
+        }
+
+        void start() noexcept;
+
+        [[nodiscard]]
+        Counters stop() noexcept;
+    };
+
+    class Suite
+    {
+        std::string filter;
+        std::chrono::nanoseconds minTime { std::chrono::milliseconds(200) };
+        std::vector<Result> results;
+
+    public:
+
+        explicit Suite(std::string_view nameFilter = {});
+
+        /** fn(n) must perform exactly n operations. The iteration count grows until minTime is reached **/
+        void run(std::string_view name, const std::function<void(uint64_t)>& fn);
+
+        /** For benchmarks that measure themselves (multi-threaded, latency distributions, ...) **/
+        void add(Result result);
+
+        [[nodiscard]]
+        bool enabled(std::string_view name) const;
+
+        void printTable() const;
+        void printJson() const;
+
+        /** Pairs '<workload>/<baseline>' with '<workload>/<candidate>' and prints the ns/op ratio **/
+        void printComparison(std::string_view baseline, std::string_view candidate) const;
+    };
+}
+
+#endif //CPPCOROUTINES_BENCHMARK_H
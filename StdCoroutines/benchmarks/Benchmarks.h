@@ -0,0 +1,36 @@
+/**============================================================================
+Name        : Benchmarks.h
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Benchmarks.h
+============================================================================**/
+
+#ifndef CPPCOROUTINES_BENCHMARKS_H
+#define CPPCOROUTINES_BENCHMARKS_H
+
+#include "Benchmark.h"
+
+namespace StdCoroutines::Benchmarks
+{
+    namespace Coroutine_Primitives { void Run(Suite& suite); }
+    namespace Event_Processor_Batching { void Run(Suite& suite); }
+    namespace State_Machine { void Run(Suite& suite); }
+    namespace Round_Robin { void Run(Suite& suite); }
+    namespace Simulation { void Run(Suite& suite); }
+    namespace Callback_Adapter { void Run(Suite& suite); }
+    namespace Timers { void Run(Suite& suite); }
+    namespace Echo_Server { void Run(Suite& suite); }
+    namespace Uring { void Run(Suite& suite); }
+    namespace File_Appender { void Run(Suite& suite); }
+    namespace Shared_Mutex { void Run(Suite& suite); }
+    namespace Sync_Primitives { void Run(Suite& suite); }
+    namespace Single_Flight { void Run(Suite& suite); }
+    namespace Async_Cache { void Run(Suite& suite); }
+    namespace Blocking_Offload { void Run(Suite& suite); }
+    namespace Priority_Scheduling { void Run(Suite& suite); }
+    namespace Deadline_Scheduling { void Run(Suite& suite); }
+}
+
+#endif //CPPCOROUTINES_BENCHMARKS_H
@@ -0,0 +1,109 @@
+/**============================================================================
+Name        : Blocking_Offload.cpp
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Compute latency next to blocking calls: run inline on the pool vs offload_blocking()
+============================================================================**/
+
+#include "Benchmarks.h"
+#include "runtime/BlockingPool.h"
+#include "runtime/Task.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <format>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    using namespace StdCoroutines::Runtime;
+    using namespace std::chrono_literals;
+    using StdCoroutines::Benchmarks::Suite;
+
+    constexpr size_t blockingCount { 64 };
+    constexpr size_t computeCount { 2'000 };
+    constexpr std::chrono::milliseconds blockingCall { 10 };
+
+    /** Stands for a synchronous file read / legacy client call **/
+    uint64_t blockingRead(const uint64_t key)
+    {
+        std::this_thread::sleep_for(blockingCall);
+        return key;
+    }
+
+    Task<> inlineBlocking(ThreadPool& pool, const uint64_t key)
+    {
+        co_await pool.schedule();
+        StdCoroutines::Benchmarks::doNotOptimize(blockingRead(key));
+    }
+
+    Task<> offloadedBlocking(ThreadPool& pool, const uint64_t key)
+    {
+        co_await pool.schedule();
+        StdCoroutines::Benchmarks::doNotOptimize(co_await offload_blocking([key] { return blockingRead(key); }, pool));
+    }
+
+    /** A short request handler: the latency is measured from its submission to its end **/
+    Task<> compute(ThreadPool& pool, std::chrono::nanoseconds& latency)
+    {
+        const auto submitted = std::chrono::steady_clock::now();
+        co_await pool.schedule();
+        auto value = static_cast<uint64_t>(submitted.time_since_epoch().count());
+        for (int i = 0; i < 2'000; ++i) {
+            value = value * 6364136223846793005ULL + 1442695040888963407ULL;
+        }
+        StdCoroutines::Benchmarks::doNotOptimize(value);
+        latency = std::chrono::steady_clock::now() - submitted;
+    }
+
+    template<typename MakeBlocking>
+    void mixed(Suite& suite, const std::string_view kind, MakeBlocking&& makeBlocking)
+    {
+        const std::string name = std::format("blocking/{}_{}x{}ms_with_{}_compute", kind, blockingCount,
+                                             blockingCall.count(), computeCount);
+        if (!suite.enabled(name)) {
+            return;
+        }
+
+        ThreadPool& pool = ThreadPool::shared();
+        std::vector<std::chrono::nanoseconds> latencies(computeCount);
+        std::vector<Task<>> tasks;
+        tasks.reserve(blockingCount + computeCount);
+        for (size_t idx = 0; idx < blockingCount; ++idx) {
+            tasks.push_back(makeBlocking(pool, idx));
+        }
+        for (size_t idx = 0; idx < computeCount; ++idx) {
+            tasks.push_back(compute(pool, latencies[idx]));
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+        syncWait(whenAll(std::move(tasks)));
+        const std::chrono::nanoseconds elapsed = std::chrono::steady_clock::now() - start;
+
+        std::ranges::sort(latencies);
+        const auto micros = [](const std::chrono::nanoseconds value) {
+            return static_cast<double>(value.count()) / 1e3;
+        };
+        StdCoroutines::Benchmarks::Result result;
+        result.name = name;
+        result.operations = computeCount;
+        result.nsPerOp = static_cast<double>(elapsed.count()) / static_cast<double>(computeCount);
+        result.extra["elapsed_ms"] = static_cast<double>(elapsed.count()) / 1e6;
+        result.extra["compute_p50_us"] = micros(latencies[computeCount / 2]);
+        result.extra["compute_p99_us"] = micros(latencies[computeCount * 99 / 100]);
+        result.extra["compute_max_us"] = micros(latencies.back());
+        result.extra["blocking_threads_peak"] = static_cast<double>(BlockingPool::shared().stats().peakThreads);
+        suite.add(std::move(result));
+    }
+}
+
+/** ns/op is wall time per compute task, the whole batch included **/
+void StdCoroutines::Benchmarks::Blocking_Offload::Run(Suite& suite)
+{
+    mixed(suite, "inline", &inlineBlocking);
+    mixed(suite, "offloaded", &offloadedBlocking);
+}
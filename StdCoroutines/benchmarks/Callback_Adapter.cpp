@@ -0,0 +1,86 @@
+/**============================================================================
+Name        : Callback_Adapter.cpp
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : co_await on a C callback API: pool adapter vs a thread per call
+============================================================================**/
+
+#include "Benchmarks.h"
+#include "runtime/CallbackAwaiter.h"
+#include "runtime/Task.h"
+
+#include <thread>
+
+namespace
+{
+    using namespace StdCoroutines::Runtime;
+    using StdCoroutines::Benchmarks::doNotOptimize;
+
+    using Callback = void (*)(void*, int);
+
+    /** A C API completing immediately on the calling thread **/
+    void immediateApi(void* userData, const Callback callback, const int value) {
+        callback(userData, value);
+    }
+
+    /** The old AsyncCallbackAPI shape: a fresh thread per call **/
+    void threadPerCallApi(void* userData, const Callback callback, const int value) {
+        std::jthread { [=] { callback(userData, value); } }.detach();
+    }
+
+    /** The coroutine is resumed by whoever invokes the callback **/
+    struct DirectAwaiter
+    {
+        std::coroutine_handle<> continuation {};
+        int result { 0 };
+
+        static void complete(void* userData, const int value)
+        {
+            auto* self = static_cast<DirectAwaiter*>(userData);
+            self->result = value;
+            self->continuation.resume();
+        }
+
+        bool await_ready() const noexcept { return false; }
+
+        void await_suspend(const std::coroutine_handle<> handle) {
+            continuation = handle;
+            threadPerCallApi(this, &complete, 1);
+        }
+
+        int await_resume() const noexcept { return result; }
+    };
+
+    Task<uint64_t> poolAdapter(const uint64_t count)
+    {
+        uint64_t sum { 0 };
+        for (uint64_t i = 0; i < count; ++i) {
+            sum += static_cast<uint64_t>(co_await fromCallback<int>([](void* userData, const Callback callback) {
+                immediateApi(userData, callback, 1);
+            }));
+        }
+        co_return sum;
+    }
+
+    Task<uint64_t> threadPerCall(const uint64_t count)
+    {
+        uint64_t sum { 0 };
+        for (uint64_t i = 0; i < count; ++i) {
+            sum += static_cast<uint64_t>(co_await DirectAwaiter {});
+        }
+        co_return sum;
+    }
+}
+
+void StdCoroutines::Benchmarks::Callback_Adapter::Run(Suite& suite)
+{
+    suite.run("callback/pool_adapter", [](const uint64_t ops) {
+        doNotOptimize(syncWait(poolAdapter(ops)));
+    });
+
+    suite.run("callback/thread_per_call", [](const uint64_t ops) {
+        doNotOptimize(syncWait(threadPerCall(ops)));
+    });
+}
@@ -0,0 +1,254 @@
+/**============================================================================
+Name        : Coroutine_Primitives.cpp
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Cost of the coroutine primitives the experiments rely on
+============================================================================**/
+
+#include "Benchmarks.h"
+#include "generators/Generator.h"
+
+#include <coroutine>
+#include <exception>
+#include <generator>
+#include <utility>
+
+namespace
+{
+    using StdCoroutines::Benchmarks::doNotOptimize;
+
+    /** Starts suspended, stays suspended at the end: the owner drives and destroys it **/
+    struct [[nodiscard]] Lazy
+    {
+        struct promise_type
+        {
+            Lazy get_return_object() {
+                return Lazy { std::coroutine_handle<promise_type>::from_promise(*this) };
+            }
+
+            std::suspend_always initial_suspend() noexcept { return {}; }
+            std::suspend_always final_suspend() noexcept { return {}; }
+            void return_void() noexcept {}
+            void unhandled_exception() { std::terminate(); }
+        };
+
+        explicit Lazy(const std::coroutine_handle<promise_type> handle) : handle { handle } {
+        }
+
+        Lazy(Lazy&& other) noexcept : handle { std::exchange(other.handle, {}) } {
+        }
+
+        ~Lazy()
+        {
+            if (handle) {
+                handle.destroy();
+            }
+        }
+
+        std::coroutine_handle<promise_type> handle;
+    };
+
+    /** Task that hands control back to its awaiter either via symmetric transfer or by plain resume() **/
+    template<bool Symmetric>
+    struct [[nodiscard]] Task
+    {
+        struct promise_type;
+
+        struct FinalAwaiter
+        {
+            bool await_ready() noexcept { return false; }
+
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> handle) noexcept
+            {
+                if constexpr (Symmetric) {
+                    if (const std::coroutine_handle<> continuation = handle.promise().continuation)
+                        return continuation;
+                }
+                return std::noop_coroutine();
+            }
+
+            void await_resume() noexcept {}
+        };
+
+        struct promise_type
+        {
+            std::coroutine_handle<> continuation {};
+
+            Task get_return_object() {
+                return Task { std::coroutine_handle<promise_type>::from_promise(*this) };
+            }
+
+            std::suspend_always initial_suspend() noexcept { return {}; }
+            FinalAwaiter final_suspend() noexcept { return {}; }
+            void return_void() noexcept {}
+            void unhandled_exception() { std::terminate(); }
+        };
+
+        explicit Task(const std::coroutine_handle<promise_type> handle) : handle { handle } {
+        }
+
+        Task(Task&& other) noexcept : handle { std::exchange(other.handle, {}) } {
+        }
+
+        ~Task()
+        {
+            if (handle) {
+                handle.destroy();
+            }
+        }
+
+        bool await_ready() const noexcept {
+            return false;
+        }
+
+        auto await_suspend(const std::coroutine_handle<> caller) noexcept
+        {
+            if constexpr (Symmetric) {
+                handle.promise().continuation = caller;
+                return handle;
+            } else {
+                /** Asymmetric: the child runs on our stack and we continue without suspending **/
+                handle.resume();
+                return false;
+            }
+        }
+
+        void await_resume() const noexcept {
+        }
+
+        std::coroutine_handle<promise_type> handle;
+    };
+
+    /** await_ready() == true: no suspension at all **/
+    struct ReadyAwaiter
+    {
+        bool await_ready() const noexcept { return true; }
+        void await_suspend(std::coroutine_handle<>) const noexcept {}
+        int await_resume() const noexcept { return 1; }
+    };
+
+    /** await_ready() == false, but await_suspend() changes its mind and returns false **/
+    struct DeclineAwaiter
+    {
+        bool await_ready() const noexcept { return false; }
+        bool await_suspend(std::coroutine_handle<>) const noexcept { return false; }
+        int await_resume() const noexcept { return 1; }
+    };
+
+    Lazy emptyCoroutine()
+    {
+        co_return;
+    }
+
+    Lazy suspendForever()
+    {
+        while (true) {
+            co_await std::suspend_always{};
+        }
+    }
+
+    template<typename Awaiter>
+    Lazy awaitInLoop(const uint64_t count, uint64_t& sum)
+    {
+        for (uint64_t i = 0; i < count; ++i) {
+            sum += co_await Awaiter{};
+        }
+    }
+
+    template<bool Symmetric>
+    Task<Symmetric> child()
+    {
+        co_return;
+    }
+
+    template<bool Symmetric>
+    Task<Symmetric> parent(const uint64_t count)
+    {
+        for (uint64_t i = 0; i < count; ++i) {
+            co_await child<Symmetric>();
+        }
+    }
+
+    StdCoroutines::Generators::Generator<uint64_t> handRolled(const uint64_t count)
+    {
+        for (uint64_t i = 0; i + 1 < count; ++i) {
+            co_yield i;
+        }
+        co_return count - 1;
+    }
+
+    std::generator<uint64_t> standard(const uint64_t count)
+    {
+        for (uint64_t i = 0; i < count; ++i) {
+            co_yield i;
+        }
+    }
+}
+
+void StdCoroutines::Benchmarks::Coroutine_Primitives::Run(Suite& suite)
+{
+    suite.run("frame/create_destroy", [](const uint64_t ops) {
+        for (uint64_t i = 0; i < ops; ++i) {
+            Lazy coro = emptyCoroutine();
+            doNotOptimize(coro.handle);
+        }
+    });
+
+    suite.run("frame/create_run_destroy", [](const uint64_t ops) {
+        for (uint64_t i = 0; i < ops; ++i) {
+            Lazy coro = emptyCoroutine();
+            coro.handle.resume();
+            doNotOptimize(coro.handle);
+        }
+    });
+
+    suite.run("resume_suspend/round_trip", [](const uint64_t ops) {
+        const Lazy coro = suspendForever();
+        for (uint64_t i = 0; i < ops; ++i) {
+            coro.handle.resume();
+        }
+    });
+
+    suite.run("awaiter/ready_fast_path", [](const uint64_t ops) {
+        uint64_t sum { 0 };
+        const Lazy coro = awaitInLoop<ReadyAwaiter>(ops, sum);
+        coro.handle.resume();
+        doNotOptimize(sum);
+    });
+
+    suite.run("awaiter/await_suspend_returns_false", [](const uint64_t ops) {
+        uint64_t sum { 0 };
+        const Lazy coro = awaitInLoop<DeclineAwaiter>(ops, sum);
+        coro.handle.resume();
+        doNotOptimize(sum);
+    });
+
+    suite.run("transfer/symmetric", [](const uint64_t ops) {
+        const Task<true> task = parent<true>(ops);
+        task.handle.resume();
+    });
+
+    suite.run("transfer/asymmetric", [](const uint64_t ops) {
+        const Task<false> task = parent<false>(ops);
+        task.handle.resume();
+    });
+
+    suite.run("generator/hand_rolled_per_element", [](const uint64_t ops) {
+        uint64_t sum { 0 };
+        auto generator = handRolled(ops);
+        while (generator.has_next()) {
+            sum += *generator.next();
+        }
+        doNotOptimize(sum);
+    });
+
+    suite.run("generator/std_generator_per_element", [](const uint64_t ops) {
+        uint64_t sum { 0 };
+        for (const uint64_t value: standard(ops)) {
+            sum += value;
+        }
+        doNotOptimize(sum);
+    });
+}
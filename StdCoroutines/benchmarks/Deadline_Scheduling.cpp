@@ -0,0 +1,139 @@
+/**============================================================================
+Name        : Deadline_Scheduling.cpp
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Deadline misses of a burst of timed pipeline jobs: FIFO pool vs EDF scheduler
+============================================================================**/
+
+#include "Benchmarks.h"
+#include "runtime/DeadlineScheduler.h"
+#include "runtime/Task.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <format>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    using namespace StdCoroutines::Runtime;
+    using namespace std::chrono_literals;
+    using StdCoroutines::Benchmarks::Suite;
+
+    constexpr size_t threadsCount { 2 };
+    constexpr size_t jobsCount { 4'000 };
+    constexpr size_t stagesCount { 2 };
+    constexpr std::chrono::microseconds stageWork { 25 };
+
+    /** Every job is feasible under EDF: the k-th earliest deadline leaves room for k jobs of work on one core **/
+    constexpr std::chrono::milliseconds minSlack { 10 }, maxSlack { 400 };
+
+    void spin(const std::chrono::nanoseconds duration)
+    {
+        const auto until = DeadlineClock::now() + duration;
+        while (DeadlineClock::now() < until) {
+        }
+    }
+
+    struct FifoExecutor
+    {
+        ThreadPool pool { threadsCount };
+
+        auto schedule() noexcept {
+            return pool.schedule();
+        }
+
+        void start(Task<> job, DeadlineClock::time_point) {
+            spawn(std::move(job));
+        }
+    };
+
+    struct EdfExecutor
+    {
+        DeadlineScheduler scheduler { DeadlineScheduler::Options { threadsCount } };
+
+        auto schedule() noexcept {
+            return scheduler.schedule();
+        }
+
+        void start(Task<> job, const DeadlineClock::time_point deadline) {
+            spawn(scheduler.submit(std::move(job), deadline));
+        }
+    };
+
+    /** A pipeline job: every stage is a hop back through the executor (ordered by the promise deadline under EDF) **/
+    template<typename Executor>
+    Task<> job(Executor& executor, const DeadlineClock::time_point deadline,
+               std::chrono::nanoseconds& lateness, std::atomic<size_t>& done)
+    {
+        for (size_t stage = 0; stage < stagesCount; ++stage) {
+            co_await executor.schedule();
+            spin(stageWork);
+        }
+        lateness = DeadlineClock::now() - deadline;
+        done.fetch_add(1, std::memory_order_release);
+    }
+
+    template<typename Executor>
+    void burst(Suite& suite, const std::string_view kind)
+    {
+        const std::string name = std::format("deadline/{}_{}_jobs_slack_{}_{}ms", kind, jobsCount,
+                                             minSlack.count(), maxSlack.count());
+        if (!suite.enabled(name)) {
+            return;
+        }
+
+        Executor executor;
+        std::mt19937_64 engine { 7 };
+        std::uniform_int_distribution<int64_t> slack { std::chrono::nanoseconds { minSlack }.count(),
+                                                       std::chrono::nanoseconds { maxSlack }.count() };
+        std::vector<std::chrono::nanoseconds> lateness(jobsCount);
+        std::atomic<size_t> done { 0 };
+
+        const auto start = DeadlineClock::now();
+        for (size_t idx = 0; idx < jobsCount; ++idx) {
+            const auto deadline = start + std::chrono::nanoseconds { slack(engine) };
+            executor.start(job(executor, deadline, lateness[idx], done), deadline);
+        }
+        while (done.load(std::memory_order_acquire) < jobsCount) {
+            std::this_thread::sleep_for(1ms);
+        }
+        const std::chrono::nanoseconds elapsed = DeadlineClock::now() - start;
+
+        std::ranges::sort(lateness);
+        const size_t misses = static_cast<size_t>(std::ranges::count_if(lateness, [](const std::chrono::nanoseconds late) {
+            return late > std::chrono::nanoseconds::zero();
+        }));
+        const auto millis = [](const std::chrono::nanoseconds value) {
+            return static_cast<double>(value.count()) / 1e6;
+        };
+        StdCoroutines::Benchmarks::Result result;
+        result.name = name;
+        result.operations = jobsCount;
+        result.nsPerOp = static_cast<double>(elapsed.count()) / static_cast<double>(jobsCount);
+        result.extra["misses"] = static_cast<double>(misses);
+        result.extra["miss_ratio"] = static_cast<double>(misses) / static_cast<double>(jobsCount);
+        result.extra["lateness_p99_ms"] = millis(std::max(lateness[jobsCount * 99 / 100], std::chrono::nanoseconds::zero()));
+        result.extra["lateness_max_ms"] = millis(std::max(lateness.back(), std::chrono::nanoseconds::zero()));
+        result.extra["elapsed_ms"] = millis(elapsed);
+        if constexpr (std::is_same_v<Executor, EdfExecutor>) {
+            const DeadlineScheduler::Stats stats = executor.scheduler.stats();
+            result.extra["late_dispatches"] = static_cast<double>(stats.lateDispatches);
+            result.extra["scheduler_missed"] = static_cast<double>(stats.missed);
+        }
+        suite.add(std::move(result));
+    }
+}
+
+/** Same work, same deadlines, released at once in random deadline order: only the dispatch order differs **/
+void StdCoroutines::Benchmarks::Deadline_Scheduling::Run(Suite& suite)
+{
+    burst<FifoExecutor>(suite, "fifo");
+    burst<EdfExecutor>(suite, "edf");
+}
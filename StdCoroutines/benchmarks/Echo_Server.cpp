@@ -0,0 +1,80 @@
+/**============================================================================
+Name        : Echo_Server.cpp
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Loopback load against the epoll echo server: req/s and latency percentiles
+============================================================================**/
+
+#include "Benchmarks.h"
+#include "experiments/EchoServer.h"
+
+#include <csignal>
+#include <format>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace
+{
+    using namespace StdCoroutines::Experiments::Echo_Server;
+    using namespace std::chrono_literals;
+
+    /** The server runs in a child process: its own descriptor table, its own CPU time **/
+    pid_t forkServer(const int listenFd)
+    {
+        const pid_t pid = ::fork();
+        if (0 == pid)
+        {
+            StdCoroutines::Runtime::Reactor reactor { 1024 };
+            EchoServer server { reactor, listenFd };
+            server.start();
+            reactor.run();
+            ::_exit(EXIT_SUCCESS);
+        }
+        return pid;
+    }
+
+    void runLoad(StdCoroutines::Benchmarks::Suite& suite, const size_t connections)
+    {
+        const std::string name = std::format("echo_server/{}_connections", connections);
+        if (!suite.enabled(name)) {
+            return;
+        }
+
+        const int listenFd = StdCoroutines::Runtime::listenTcp();
+        const sockaddr_in address = StdCoroutines::Runtime::localAddress(listenFd);
+        const pid_t server = forkServer(listenFd);
+        ::close(listenFd);
+        if (server < 0) {
+            return;
+        }
+
+        LoadGenerator generator;
+        const LoadStats stats = generator.run(address, connections, 2s);
+
+        ::kill(server, SIGKILL);
+        ::waitpid(server, nullptr, 0);
+
+        StdCoroutines::Benchmarks::Result result;
+        result.name = name;
+        result.operations = stats.requests;
+        result.nsPerOp = stats.requests > 0 ? static_cast<double>(stats.elapsed.count()) / stats.requests : 0.0;
+        result.extra["req_per_sec"] = stats.requestsPerSecond();
+        result.extra["p50_us"] = stats.percentileUs(0.5);
+        result.extra["p99_us"] = stats.percentileUs(0.99);
+        result.extra["p999_us"] = stats.percentileUs(0.999);
+        result.extra["failed_connections"] = static_cast<double>(stats.failedConnections);
+        result.extra["timed_out_reads"] = static_cast<double>(stats.timedOutReads);
+        suite.add(std::move(result));
+    }
+}
+
+void StdCoroutines::Benchmarks::Echo_Server::Run(Suite& suite)
+{
+    /** 10k client sockets (and, in the forked server, 10k accepted ones) do not fit the usual 1024 limit **/
+    raiseDescriptorLimit();
+    runLoad(suite, 100);
+    runLoad(suite, 10'000);
+}
@@ -0,0 +1,86 @@
+/**============================================================================
+Name        : Event_Processor_Batching.cpp
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : EventQueue throughput: one event per resume vs next_batch(N)
+============================================================================**/
+
+#include "Benchmarks.h"
+#include "experiments/EventQueue.h"
+#include "runtime/AllocationHook.h"
+
+#include <chrono>
+#include <format>
+#include <span>
+#include <thread>
+
+namespace
+{
+    using namespace StdCoroutines::Experiments::Event_Processor;
+    using StdCoroutines::Benchmarks::doNotOptimize;
+
+    constexpr int eventsCount { 1'000'000 };
+
+    EventHandlerCoro drain(EventQueue& queue, const size_t maxBatch, uint64_t& awaits, uint64_t& sum)
+    {
+        while (true) {
+            const std::span<Event> events = co_await queue.next_batch(maxBatch);
+            if (events.empty()) {
+                break;
+            }
+            ++awaits;
+            for (const Event& event: events) {
+                sum += static_cast<uint64_t>(event.id) + event.data.size();
+            }
+        }
+    }
+
+    void runBatched(StdCoroutines::Benchmarks::Suite& suite, const size_t maxBatch)
+    {
+        const std::string name = std::format("event_queue/next_batch_{}", maxBatch);
+        if (!suite.enabled(name)) {
+            return;
+        }
+
+        EventQueue queue;
+        uint64_t awaits { 0 }, sum { 0 };
+
+        const auto allocationsBefore = StdCoroutines::Runtime::Allocations::global();
+        const auto start = std::chrono::steady_clock::now();
+        std::thread producer([&queue]() {
+            for (int i = 0; i < eventsCount; ++i) {
+                queue.push(Event { i, "payload" });
+            }
+            queue.close();
+        });
+
+        const EventHandlerCoro handler = drain(queue, maxBatch, awaits, sum);
+        queue.run(handler.coroHandle);
+        producer.join();
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        const auto allocationsAfter = StdCoroutines::Runtime::Allocations::global();
+        doNotOptimize(sum);
+
+        const auto events = static_cast<double>(eventsCount);
+        const auto ns = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+
+        StdCoroutines::Benchmarks::Result result;
+        result.name = name;
+        result.operations = eventsCount;
+        result.nsPerOp = ns / events;
+        result.allocationsPerOp = static_cast<double>(allocationsAfter.count - allocationsBefore.count) / events;
+        result.bytesPerOp = static_cast<double>(allocationsAfter.bytes - allocationsBefore.bytes) / events;
+        result.extra["events_per_sec"] = events * 1e9 / ns;
+        result.extra["awaits_per_event"] = static_cast<double>(awaits) / events;
+        suite.add(std::move(result));
+    }
+}
+
+void StdCoroutines::Benchmarks::Event_Processor_Batching::Run(Suite& suite)
+{
+    for (const size_t maxBatch: { 1u, 16u, 256u }) {
+        runBatched(suite, maxBatch);
+    }
+}
@@ -0,0 +1,90 @@
+/**============================================================================
+Name        : File_Appender.cpp
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : FileUtilities::AppendToFile vs group committed co_await appender.append()
+============================================================================**/
+
+#include "Benchmarks.h"
+#include "FileUtilities.h"
+#include "runtime/FileAppender.h"
+#include "runtime/Task.h"
+
+#include <chrono>
+#include <filesystem>
+#include <format>
+#include <string>
+#include <vector>
+
+namespace
+{
+    using namespace StdCoroutines::Runtime;
+    using StdCoroutines::Benchmarks::Suite;
+
+    const std::filesystem::path journal { "/tmp/coro_bench_journal.log" };
+    const std::string record { "2026-10-18 12:00:00.000000 [INFO] journal record of 64 bytes...\n" };
+
+    Task<> writer(ThreadPool& pool, FileAppender& appender, const uint64_t appends)
+    {
+        co_await pool.schedule();
+        for (uint64_t i = 0; i < appends; ++i) {
+            if (co_await appender.append(record) < 0)
+                break;
+        }
+    }
+
+    void groupCommit(Suite& suite, const size_t writers, const bool durable)
+    {
+        const std::string name = std::format("file_append/appender_{}_writers_{}", writers, durable ? "fdatasync" : "page_cache");
+        if (!suite.enabled(name)) {
+            return;
+        }
+
+        /** Every writer has one append in flight: a batch holds at most 'writers' records **/
+        const uint64_t appendsPerWriter = std::max<uint64_t>(1, (durable ? 20'000 : 200'000) / writers);
+        std::filesystem::remove(journal);
+
+        ThreadPool& pool = ThreadPool::shared();
+        FileAppender::Stats stats;
+        std::chrono::nanoseconds elapsed {};
+        {
+            FileAppender appender { journal, FileAppender::Options { .durable = durable } };
+            std::vector<Task<>> tasks;
+            for (size_t idx = 0; idx < writers; ++idx) {
+                tasks.push_back(writer(pool, appender, appendsPerWriter));
+            }
+            const auto start = std::chrono::steady_clock::now();
+            syncWait(whenAll(std::move(tasks)));
+            elapsed = std::chrono::steady_clock::now() - start;
+            stats = appender.stats();
+        }
+        std::filesystem::remove(journal);
+
+        StdCoroutines::Benchmarks::Result result;
+        result.name = name;
+        result.operations = stats.appends;
+        result.nsPerOp = static_cast<double>(elapsed.count()) / static_cast<double>(stats.appends);
+        result.extra["appends_per_sec"] = static_cast<double>(stats.appends) * 1e9 / static_cast<double>(elapsed.count());
+        result.extra["appends_per_batch"] = static_cast<double>(stats.appends) / static_cast<double>(stats.batches);
+        suite.add(std::move(result));
+    }
+}
+
+void StdCoroutines::Benchmarks::File_Appender::Run(Suite& suite)
+{
+    std::filesystem::remove(journal);
+    suite.run("file_append/AppendToFile", [](const uint64_t ops) {
+        for (uint64_t i = 0; i < ops; ++i) {
+            FileUtilities::AppendToFile(journal, record);
+        }
+    });
+    std::filesystem::remove(journal);
+
+    for (const size_t writers: { 1, 64 }) {
+        for (const bool durable: { false, true }) {
+            groupCommit(suite, writers, durable);
+        }
+    }
+}
@@ -0,0 +1,135 @@
+/**============================================================================
+Name        : Priority_Scheduling.cpp
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Latency of high priority requests while low priority batch work saturates the workers
+============================================================================**/
+
+#include "Benchmarks.h"
+#include "runtime/PriorityScheduler.h"
+#include "runtime/Task.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <format>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    using namespace StdCoroutines::Runtime;
+    using namespace std::chrono_literals;
+    using StdCoroutines::Benchmarks::Suite;
+    using SteadyClock = std::chrono::steady_clock;
+
+    constexpr size_t threadsCount { 2 };
+    constexpr size_t batchCount { 20'000 };
+    constexpr size_t requestsCount { 1'000 };
+    constexpr std::chrono::microseconds requestInterval { 200 };
+
+    void spin(const std::chrono::nanoseconds duration)
+    {
+        const auto until = SteadyClock::now() + duration;
+        while (SteadyClock::now() < until) {
+        }
+    }
+
+    /** Both executors behind one interface: the FIFO pool ignores the priority **/
+    struct FifoExecutor
+    {
+        ThreadPool pool { threadsCount };
+
+        auto schedule(Priority) noexcept {
+            return pool.schedule();
+        }
+    };
+
+    struct PriorityExecutor
+    {
+        PriorityScheduler scheduler { PriorityScheduler::Options { threadsCount } };
+
+        auto schedule(const Priority priority) noexcept {
+            return scheduler.schedule(priority);
+        }
+    };
+
+    template<typename Executor>
+    Task<> batchJob(Executor& executor)
+    {
+        co_await executor.schedule(Priority::Low);
+        spin(50us);
+    }
+
+    template<typename Executor>
+    Task<> request(Executor& executor, const SteadyClock::time_point submitted,
+                   std::chrono::nanoseconds& latency, std::atomic<size_t>& done)
+    {
+        co_await executor.schedule(Priority::High);
+        spin(5us);
+        latency = SteadyClock::now() - submitted;
+        done.fetch_add(1, std::memory_order_release);
+    }
+
+    template<typename Executor>
+    void saturated(Suite& suite, const std::string_view kind)
+    {
+        const std::string name = std::format("priority/{}_high_requests_under_{}_batch_jobs", kind, batchCount);
+        if (!suite.enabled(name)) {
+            return;
+        }
+
+        Executor executor;
+        std::vector<Task<>> batch;
+        batch.reserve(batchCount);
+        for (size_t idx = 0; idx < batchCount; ++idx) {
+            batch.push_back(batchJob(executor));
+        }
+
+        std::vector<std::chrono::nanoseconds> latencies(requestsCount);
+        std::atomic<size_t> done { 0 };
+        const auto start = SteadyClock::now();
+        std::jthread batchRunner { [&batch] { syncWait(whenAll(std::move(batch))); } };
+
+        /** Open loop: requests arrive on schedule, whether or not the previous ones are done **/
+        std::this_thread::sleep_for(20ms);
+        for (size_t idx = 0; idx < requestsCount; ++idx) {
+            spawn(request(executor, SteadyClock::now(), latencies[idx], done));
+            std::this_thread::sleep_for(requestInterval);
+        }
+        while (done.load(std::memory_order_acquire) < requestsCount) {
+            std::this_thread::sleep_for(1ms);
+        }
+        const std::chrono::nanoseconds requestsDone = SteadyClock::now() - start;
+        batchRunner.join();
+        const std::chrono::nanoseconds elapsed = SteadyClock::now() - start;
+
+        std::ranges::sort(latencies);
+        const auto micros = [](const std::chrono::nanoseconds value) {
+            return static_cast<double>(value.count()) / 1e3;
+        };
+        StdCoroutines::Benchmarks::Result result;
+        result.name = name;
+        result.operations = requestsCount;
+        result.nsPerOp = static_cast<double>(latencies[requestsCount / 2].count());
+        result.extra["high_p50_us"] = micros(latencies[requestsCount / 2]);
+        result.extra["high_p99_us"] = micros(latencies[requestsCount * 99 / 100]);
+        result.extra["high_max_us"] = micros(latencies.back());
+        result.extra["requests_done_ms"] = static_cast<double>(requestsDone.count()) / 1e6;
+        result.extra["batch_done_ms"] = static_cast<double>(elapsed.count()) / 1e6;
+        if constexpr (std::is_same_v<Executor, PriorityExecutor>) {
+            result.extra["aged_picks"] = static_cast<double>(executor.scheduler.stats().aged);
+        }
+        suite.add(std::move(result));
+    }
+}
+
+/** ns/op is the median high priority latency; the batch is 20000 x 50us of spinning on two workers **/
+void StdCoroutines::Benchmarks::Priority_Scheduling::Run(Suite& suite)
+{
+    saturated<FifoExecutor>(suite, "fifo");
+    saturated<PriorityExecutor>(suite, "priority");
+}
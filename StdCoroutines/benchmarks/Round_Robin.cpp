@@ -0,0 +1,87 @@
+/**============================================================================
+Name        : Round_Robin.cpp
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Cost of switching between many suspended coroutines
+============================================================================**/
+
+#include "Benchmarks.h"
+#include "runtime/RoundRobin.h"
+
+#include <algorithm>
+#include <format>
+#include <random>
+#include <vector>
+
+namespace
+{
+    using StdCoroutines::Runtime::RoundRobin;
+    using StdCoroutines::Benchmarks::doNotOptimize;
+
+    /** Roughly the same number of resumes for every configuration **/
+    constexpr uint64_t resumesPerRun { 20'000'000 };
+
+    RoundRobin::Player spinner(RoundRobin& scheduler, uint64_t& counter)
+    {
+        while (true) {
+            ++counter;
+            co_await scheduler.yield();
+        }
+    }
+
+    /**
+     * 'shuffled' creates the frames in one order and queues them in another, so consecutive
+     * resumes touch unrelated cache lines - the case the prefetching is there for
+    **/
+    void runPlayers(StdCoroutines::Benchmarks::Suite& suite, const size_t players,
+                    const bool shuffled, const size_t prefetchDistance)
+    {
+        const std::string name = std::format("round_robin/{}_players{}/prefetch_{}",
+                                             players, shuffled ? "_shuffled" : "", prefetchDistance);
+        if (!suite.enabled(name)) {
+            return;
+        }
+
+        RoundRobin scheduler { prefetchDistance };
+        scheduler.reserve(players);
+        uint64_t counter { 0 };
+
+        std::vector<RoundRobin::Player> created;
+        created.reserve(players);
+        for (size_t idx = 0; idx < players; ++idx) {
+            created.push_back(spinner(scheduler, counter));
+        }
+        if (shuffled) {
+            std::shuffle(created.begin(), created.end(), std::mt19937_64 { 42 });
+        }
+        for (const RoundRobin::Player& player: created) {
+            scheduler.spawn(player);
+        }
+
+        /** The first round only runs the players up to their first yield() **/
+        scheduler.runRounds(1);
+        const uint64_t rounds = std::max<uint64_t>(1, resumesPerRun / players);
+        const RoundRobin::Stats stats = scheduler.runRounds(rounds);
+        doNotOptimize(counter);
+
+        StdCoroutines::Benchmarks::Result result;
+        result.name = name;
+        result.operations = stats.resumes;
+        result.nsPerOp = stats.nsPerResume();
+        result.extra["rounds"] = static_cast<double>(stats.rounds);
+        result.extra["resumes_per_sec"] = 1e9 / stats.nsPerResume();
+        suite.add(std::move(result));
+    }
+}
+
+void StdCoroutines::Benchmarks::Round_Robin::Run(Suite& suite)
+{
+    for (const size_t prefetchDistance: { 0u, 8u })
+    {
+        runPlayers(suite, 1'000, false, prefetchDistance);
+        runPlayers(suite, 1'000'000, false, prefetchDistance);
+        runPlayers(suite, 1'000'000, true, prefetchDistance);
+    }
+}
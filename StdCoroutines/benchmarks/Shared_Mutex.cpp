@@ -0,0 +1,145 @@
+/**============================================================================
+Name        : Shared_Mutex.cpp
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Read-heavy mixes: AsyncSharedMutex vs AsyncMutex vs std::shared_mutex
+============================================================================**/
+
+#include "Benchmarks.h"
+#include "runtime/AsyncMutex.h"
+#include "runtime/AsyncSharedMutex.h"
+#include "runtime/Task.h"
+
+#include <array>
+#include <chrono>
+#include <format>
+#include <shared_mutex>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+    using namespace StdCoroutines::Runtime;
+    using StdCoroutines::Benchmarks::Suite;
+
+    constexpr size_t tasksCount { 64 };
+    constexpr uint64_t operationsPerTask { 20'000 };
+
+    /** Guarded data: a read sums it, a write bumps every element **/
+    struct Table
+    {
+        std::array<uint64_t, 16> values {};
+
+        [[nodiscard]]
+        uint64_t read() const noexcept
+        {
+            uint64_t sum { 0 };
+            for (const uint64_t value: values)
+                sum += value;
+            return sum;
+        }
+
+        void write() noexcept
+        {
+            for (uint64_t& value: values)
+                ++value;
+        }
+    };
+
+    /** Writes spread evenly: every 'writeEvery'-th operation of a task is a write (0 - never) **/
+    [[nodiscard]]
+    bool isWrite(const uint64_t operation, const size_t task, const uint64_t writeEvery) noexcept {
+        return 0 != writeEvery && 0 == (operation + task) % writeEvery;
+    }
+
+    Task<> sharedMutexTask(ThreadPool& pool, AsyncSharedMutex& mutex, Table& table,
+                           const size_t task, const uint64_t writeEvery, uint64_t& sink)
+    {
+        co_await pool.schedule();
+        for (uint64_t i = 0; i < operationsPerTask; ++i)
+        {
+            if (isWrite(i, task, writeEvery)) {
+                const UniqueLock lock = co_await mutex.scoped_lock();
+                table.write();
+            } else {
+                const SharedLock lock = co_await mutex.lock_shared();
+                sink += table.read();
+            }
+        }
+    }
+
+    Task<> asyncMutexTask(ThreadPool& pool, AsyncMutex& mutex, Table& table,
+                          const size_t task, const uint64_t writeEvery, uint64_t& sink)
+    {
+        co_await pool.schedule();
+        for (uint64_t i = 0; i < operationsPerTask; ++i)
+        {
+            const AsyncLock lock = co_await mutex.scoped_lock();
+            if (isWrite(i, task, writeEvery))
+                table.write();
+            else
+                sink += table.read();
+        }
+    }
+
+    /** Blocks the pool thread while waiting: the baseline the coroutine locks are meant to replace **/
+    Task<> stdSharedMutexTask(ThreadPool& pool, std::shared_mutex& mutex, Table& table,
+                              const size_t task, const uint64_t writeEvery, uint64_t& sink)
+    {
+        co_await pool.schedule();
+        for (uint64_t i = 0; i < operationsPerTask; ++i)
+        {
+            if (isWrite(i, task, writeEvery)) {
+                const std::unique_lock lock { mutex };
+                table.write();
+            } else {
+                const std::shared_lock lock { mutex };
+                sink += table.read();
+            }
+        }
+    }
+
+    template<typename Mutex, typename TaskFactory>
+    void mix(Suite& suite, const std::string_view lockName, const uint64_t writeEvery, TaskFactory&& makeTask)
+    {
+        const std::string name = std::format("shared_mutex/{}_writes_{}", lockName,
+                                             0 == writeEvery ? std::string { "0%" } : std::format("{}%", 100 / writeEvery));
+        if (!suite.enabled(name)) {
+            return;
+        }
+
+        ThreadPool& pool = ThreadPool::shared();
+        Mutex mutex;
+        Table table;
+        std::array<uint64_t, tasksCount> sinks {};
+
+        std::vector<Task<>> tasks;
+        for (size_t idx = 0; idx < tasksCount; ++idx) {
+            tasks.push_back(makeTask(pool, mutex, table, idx, writeEvery, sinks[idx]));
+        }
+        const auto start = std::chrono::steady_clock::now();
+        syncWait(whenAll(std::move(tasks)));
+        const std::chrono::nanoseconds elapsed = std::chrono::steady_clock::now() - start;
+
+        constexpr uint64_t operations { tasksCount * operationsPerTask };
+        StdCoroutines::Benchmarks::Result result;
+        result.name = name;
+        result.operations = operations;
+        result.nsPerOp = static_cast<double>(elapsed.count()) / static_cast<double>(operations);
+        result.extra["ops_per_sec"] = static_cast<double>(operations) * 1e9 / static_cast<double>(elapsed.count());
+        suite.add(std::move(result));
+    }
+}
+
+void StdCoroutines::Benchmarks::Shared_Mutex::Run(Suite& suite)
+{
+    /** Write shares: none, 1% and 10% **/
+    for (const uint64_t writeEvery: { 0, 100, 10 })
+    {
+        mix<AsyncSharedMutex>(suite, "async_shared_mutex", writeEvery, &sharedMutexTask);
+        mix<AsyncMutex>(suite, "async_mutex", writeEvery, &asyncMutexTask);
+        mix<std::shared_mutex>(suite, "std_shared_mutex", writeEvery, &stdSharedMutexTask);
+    }
+}
@@ -0,0 +1,88 @@
+/**============================================================================
+Name        : Simulation.cpp
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Discrete-event simulation throughput (simulated events per second)
+============================================================================**/
+
+#include "Benchmarks.h"
+#include "runtime/Simulation.h"
+
+#include <format>
+#include <thread>
+
+namespace
+{
+    using namespace StdCoroutines::Runtime::Simulation;
+    using namespace std::chrono_literals;
+    using StdCoroutines::Benchmarks::Result;
+
+    Process entity(Simulator& sim, const int id, const int steps)
+    {
+        for (int step = 0; step < steps; ++step) {
+            co_await sim.delay(1ms * (1 + (id * 7 + step) % 13));
+        }
+    }
+
+    Process roamingEntity(Simulator& home, ParallelSimulation& world, const int id, const int steps)
+    {
+        Simulator* sim = &home;
+        for (int step = 0; step < steps; ++step)
+        {
+            co_await sim->delay(1ms * (1 + (id * 7 + step) % 13));
+            if (0 == step % 16) {
+                sim = &co_await sim->migrate(world.partition(static_cast<size_t>(id + step) % world.size()),
+                                             world.lookahead());
+            }
+        }
+    }
+
+    Result toResult(std::string name, const Stats& stats)
+    {
+        Result result;
+        result.name = std::move(name);
+        result.operations = stats.events;
+        result.nsPerOp = static_cast<double>(stats.wallTime.count()) / static_cast<double>(stats.events);
+        result.extra["events_per_sec"] = stats.eventsPerSecond();
+        result.extra["windows"] = static_cast<double>(stats.windows);
+        return result;
+    }
+}
+
+void StdCoroutines::Benchmarks::Simulation::Run(Suite& suite)
+{
+    constexpr int steps { 200 };
+
+    for (const int entities: { 1'000, 100'000 })
+    {
+        const std::string name = std::format("simulation/sequential_{}_entities", entities);
+        if (!suite.enabled(name)) {
+            continue;
+        }
+        Simulator sim;
+        sim.reserve(static_cast<size_t>(entities));
+        for (int id = 0; id < entities; ++id) {
+            sim.spawn(entity(sim, id, steps));
+        }
+        suite.add(toResult(name, sim.run()));
+    }
+
+    const size_t partitions = std::max(2u, std::thread::hardware_concurrency());
+    for (const int entities: { 1'000, 100'000 })
+    {
+        const std::string name = std::format("simulation/parallel_{}_entities", entities);
+        if (!suite.enabled(name)) {
+            continue;
+        }
+        ParallelSimulation world { partitions, 5ms };
+        for (int id = 0; id < entities; ++id) {
+            Simulator& home = world.partition(static_cast<size_t>(id) % world.size());
+            home.spawn(roamingEntity(home, world, id, steps));
+        }
+        Result result = toResult(name, world.run());
+        result.extra["partitions"] = static_cast<double>(partitions);
+        suite.add(std::move(result));
+    }
+}
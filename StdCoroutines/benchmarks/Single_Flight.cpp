@@ -0,0 +1,95 @@
+/**============================================================================
+Name        : Single_Flight.cpp
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Thundering herd: every request loads vs SingleFlightCache collapsing them
+============================================================================**/
+
+#include "Benchmarks.h"
+#include "runtime/SingleFlightCache.h"
+#include "runtime/Task.h"
+#include "runtime/TimerService.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <format>
+#include <vector>
+
+namespace
+{
+    using namespace StdCoroutines::Runtime;
+    using namespace std::chrono_literals;
+    using StdCoroutines::Benchmarks::Suite;
+
+    constexpr size_t requestsCount { 10'000 };
+    constexpr uint64_t keysCount { 16 };
+
+    std::atomic<uint64_t> loaderCalls { 0 };
+
+    /** A backend round trip followed by some CPU work to decode the reply **/
+    Task<uint64_t> loadFromBackend(const uint64_t key)
+    {
+        loaderCalls.fetch_add(1, std::memory_order_relaxed);
+        co_await sleep_for(2ms);
+        uint64_t value { key };
+        for (int i = 0; i < 20'000; ++i) {
+            value = value * 6364136223846793005ULL + 1442695040888963407ULL;
+        }
+        co_return value;
+    }
+
+    Task<> directRequest(ThreadPool& pool, const uint64_t key, uint64_t& sink)
+    {
+        co_await pool.schedule();
+        sink = co_await loadFromBackend(key);
+    }
+
+    Task<> cachedRequest(ThreadPool& pool, SingleFlightCache<uint64_t, uint64_t>& cache, const uint64_t key, uint64_t& sink)
+    {
+        co_await pool.schedule();
+        sink = co_await cache.get(key);
+    }
+
+    template<typename MakeRequest>
+    void herd(Suite& suite, const std::string_view kind, MakeRequest&& makeRequest)
+    {
+        const std::string name = std::format("single_flight/{}_{}_requests_{}_keys", kind, requestsCount, keysCount);
+        if (!suite.enabled(name)) {
+            return;
+        }
+
+        ThreadPool& pool = ThreadPool::shared();
+        std::vector<uint64_t> sinks(requestsCount);
+        loaderCalls.store(0);
+
+        std::vector<Task<>> requests;
+        requests.reserve(requestsCount);
+        for (size_t idx = 0; idx < requestsCount; ++idx) {
+            requests.push_back(makeRequest(pool, idx % keysCount, sinks[idx]));
+        }
+        const auto start = std::chrono::steady_clock::now();
+        syncWait(whenAll(std::move(requests)));
+        const std::chrono::nanoseconds elapsed = std::chrono::steady_clock::now() - start;
+
+        StdCoroutines::Benchmarks::Result result;
+        result.name = name;
+        result.operations = requestsCount;
+        result.nsPerOp = static_cast<double>(elapsed.count()) / static_cast<double>(requestsCount);
+        result.extra["loader_calls"] = static_cast<double>(loaderCalls.load());
+        result.extra["elapsed_ms"] = static_cast<double>(elapsed.count()) / 1e6;
+        suite.add(std::move(result));
+    }
+}
+
+void StdCoroutines::Benchmarks::Single_Flight::Run(Suite& suite)
+{
+    herd(suite, "direct", &directRequest);
+
+    SingleFlightCache<uint64_t, uint64_t> cache { [](const uint64_t& key) { return loadFromBackend(key); } };
+    herd(suite, "single_flight", [&cache](ThreadPool& pool, const uint64_t key, uint64_t& sink) {
+        return cachedRequest(pool, cache, key, sink);
+    });
+}
@@ -0,0 +1,82 @@
+/**============================================================================
+Name        : State_Machine.cpp
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Cost of one event dispatch in a flat array of table driven machines
+============================================================================**/
+
+#include "Benchmarks.h"
+#include "runtime/StateMachine.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace
+{
+    using namespace StdCoroutines::Runtime::StateMachine;
+    using StdCoroutines::Benchmarks::doNotOptimize;
+
+    enum class State : uint8_t { Idle, Connecting, Connected, Closing, Count };
+    enum class Event : uint8_t { Connect, Established, Close, Closed, Count };
+
+    constexpr TransitionTable<State, Event> table {
+        State::Idle, {
+            { State::Idle,       Event::Connect,     State::Connecting },
+            { State::Connecting, Event::Established, State::Connected  },
+            { State::Connected,  Event::Close,       State::Closing    },
+            { State::Closing,    Event::Closed,      State::Idle       },
+        }
+    };
+
+    constexpr size_t machinesCount { 4096 };
+    constexpr Event cycle[] { Event::Connect, Event::Established, Event::Close, Event::Closed };
+
+    Behaviour<table> countTransitions(Machines<table>& machines, const size_t idx, uint64_t& transitions)
+    {
+        while (true) {
+            const auto step = co_await machines.transitions(idx);
+            transitions += static_cast<uint64_t>(step.to);
+        }
+    }
+
+    /** ops is rounded up to whole ticks over all machines **/
+    void runTicks(Machines<table>& machines, const uint64_t ops)
+    {
+        std::vector<Event> events(machinesCount);
+        for (uint64_t done = 0, tick = 0; done < ops; done += machinesCount, ++tick)
+        {
+            std::fill(events.begin(), events.end(), cycle[tick % std::size(cycle)]);
+            doNotOptimize(machines.step(events));
+        }
+    }
+}
+
+void StdCoroutines::Benchmarks::State_Machine::Run(Suite& suite)
+{
+    suite.run("state_machine/table_dispatch", [](const uint64_t ops) {
+        Machines<table> machines { machinesCount };
+        runTicks(machines, ops);
+    });
+
+    suite.run("state_machine/rejected_event", [](const uint64_t ops) {
+        Machines<table> machines { machinesCount };
+        for (uint64_t i = 0; i < ops; ++i) {
+            doNotOptimize(machines.dispatch(i % machinesCount, Event::Closed));
+        }
+    });
+
+    suite.run("state_machine/behaviour_dispatch", [](const uint64_t ops) {
+        Machines<table> machines { machinesCount };
+        uint64_t transitions { 0 };
+        std::vector<Behaviour<table>> behaviours;
+        behaviours.reserve(machinesCount);
+        for (size_t idx = 0; idx < machinesCount; ++idx) {
+            behaviours.push_back(countTransitions(machines, idx, transitions));
+        }
+        runTicks(machines, ops);
+        doNotOptimize(transitions);
+    });
+}
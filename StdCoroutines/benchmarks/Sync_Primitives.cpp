@@ -0,0 +1,225 @@
+/**============================================================================
+Name        : Sync_Primitives.cpp
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : AsyncSemaphore bounded fan-out, latch / barrier / event wakeups
+============================================================================**/
+
+#include "Benchmarks.h"
+#include "runtime/AsyncBarrier.h"
+#include "runtime/AsyncEvent.h"
+#include "runtime/AsyncLatch.h"
+#include "runtime/AsyncSemaphore.h"
+#include "runtime/Task.h"
+#include "runtime/TimerService.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <format>
+#include <vector>
+
+namespace
+{
+    using namespace StdCoroutines::Runtime;
+    using namespace std::chrono_literals;
+    using StdCoroutines::Benchmarks::Suite;
+
+    struct InFlight
+    {
+        std::atomic<int64_t> current { 0 };
+        std::atomic<int64_t> peak { 0 };
+
+        void enter() noexcept
+        {
+            const int64_t now = current.fetch_add(1, std::memory_order_relaxed) + 1;
+            int64_t seen = peak.load(std::memory_order_relaxed);
+            while (seen < now && !peak.compare_exchange_weak(seen, now, std::memory_order_relaxed)) {
+            }
+        }
+
+        void leave() noexcept {
+            current.fetch_sub(1, std::memory_order_relaxed);
+        }
+    };
+
+    /** One simulated I/O request: at most 'permits' of them are in flight at any moment **/
+    Task<> request(AsyncSemaphore& semaphore, InFlight& inFlight)
+    {
+        const SemaphorePermit permit = co_await semaphore.scoped_acquire();
+        inFlight.enter();
+        co_await sleep_for(1ms);
+        inFlight.leave();
+    }
+
+    void boundedFanOut(Suite& suite, const int64_t permits)
+    {
+        constexpr size_t requests { 2'000 };
+        const std::string name = std::format("sync/semaphore_fan_out_{}_requests_{}_permits", requests, permits);
+        if (!suite.enabled(name)) {
+            return;
+        }
+
+        AsyncSemaphore semaphore { permits };
+        InFlight inFlight;
+        std::vector<Task<>> tasks;
+        for (size_t idx = 0; idx < requests; ++idx) {
+            tasks.push_back(request(semaphore, inFlight));
+        }
+        const auto start = std::chrono::steady_clock::now();
+        syncWait(whenAll(std::move(tasks)));
+        const std::chrono::nanoseconds elapsed = std::chrono::steady_clock::now() - start;
+
+        StdCoroutines::Benchmarks::Result result;
+        result.name = name;
+        result.operations = requests;
+        result.nsPerOp = static_cast<double>(elapsed.count()) / static_cast<double>(requests);
+        result.extra["peak_in_flight"] = static_cast<double>(inFlight.peak.load());
+        result.extra["elapsed_ms"] = static_cast<double>(elapsed.count()) / 1e6;
+        suite.add(std::move(result));
+    }
+
+    Task<> contender(ThreadPool& pool, AsyncSemaphore& semaphore, const uint64_t rounds)
+    {
+        co_await pool.schedule();
+        for (uint64_t i = 0; i < rounds; ++i) {
+            co_await semaphore.acquire();
+            semaphore.release();
+        }
+    }
+
+    void semaphoreContention(Suite& suite, const int64_t permits)
+    {
+        constexpr size_t tasksCount { 64 };
+        constexpr uint64_t rounds { 20'000 };
+        const std::string name = std::format("sync/semaphore_acquire_release_{}_tasks_{}_permits", tasksCount, permits);
+        if (!suite.enabled(name)) {
+            return;
+        }
+
+        ThreadPool& pool = ThreadPool::shared();
+        AsyncSemaphore semaphore { permits };
+        std::vector<Task<>> tasks;
+        for (size_t idx = 0; idx < tasksCount; ++idx) {
+            tasks.push_back(contender(pool, semaphore, rounds));
+        }
+        const auto start = std::chrono::steady_clock::now();
+        syncWait(whenAll(std::move(tasks)));
+        const std::chrono::nanoseconds elapsed = std::chrono::steady_clock::now() - start;
+
+        StdCoroutines::Benchmarks::Result result;
+        result.name = name;
+        result.operations = tasksCount * rounds;
+        result.nsPerOp = static_cast<double>(elapsed.count()) / static_cast<double>(result.operations);
+        suite.add(std::move(result));
+    }
+
+    Task<> latchWorker(ThreadPool& pool, AsyncLatch& done)
+    {
+        co_await pool.schedule();
+        done.count_down();
+    }
+
+    Task<> latchRound(ThreadPool& pool, const size_t workers)
+    {
+        AsyncLatch done { static_cast<int64_t>(workers) };
+        for (size_t idx = 0; idx < workers; ++idx) {
+            spawn(latchWorker(pool, done));
+        }
+        co_await done.wait();
+    }
+
+    Task<> eventWaiter(AsyncManualResetEvent& event, uint64_t& resumed)
+    {
+        co_await event;
+        ++resumed;
+    }
+
+    Task<> phaseWorker(ThreadPool& pool, AsyncBarrier& barrier, const uint64_t phases)
+    {
+        co_await pool.schedule();
+        for (uint64_t i = 0; i < phases; ++i) {
+            co_await barrier.arrive_and_wait();
+        }
+    }
+}
+
+void StdCoroutines::Benchmarks::Sync_Primitives::Run(Suite& suite)
+{
+    ThreadPool& pool = ThreadPool::shared();
+
+    suite.run("sync/semaphore_uncontended_acquire_release", [](const uint64_t ops) {
+        AsyncSemaphore semaphore { 1 };
+        syncWait([](AsyncSemaphore& semaphore, const uint64_t ops) -> Task<> {
+            for (uint64_t i = 0; i < ops; ++i) {
+                co_await semaphore.acquire();
+                semaphore.release();
+            }
+        }(semaphore, ops));
+    });
+
+    for (const int64_t permits: { 1, 8 }) {
+        semaphoreContention(suite, permits);
+    }
+    for (const int64_t permits: { 16, 128 }) {
+        boundedFanOut(suite, permits);
+    }
+
+    /** One op: 64 workers posted to the pool and joined through the latch **/
+    suite.run("sync/latch_fan_in_64_workers", [&pool](const uint64_t ops) {
+        for (uint64_t i = 0; i < ops; ++i) {
+            syncWait(latchRound(pool, 64));
+        }
+    });
+
+    /** One op: one phase of 16 participants **/
+    suite.run("sync/barrier_phase_16_participants", [&pool](const uint64_t ops) {
+        constexpr size_t participants { 16 };
+        AsyncBarrier barrier { participants };
+        std::vector<Task<>> tasks;
+        for (size_t idx = 0; idx < participants; ++idx) {
+            tasks.push_back(phaseWorker(pool, barrier, ops));
+        }
+        syncWait(whenAll(std::move(tasks)));
+    });
+
+    /** One op: one waiter resumed. The waiters are resumed inline, inside set() **/
+    suite.run("sync/manual_event_broadcast_1000_waiters", [](const uint64_t ops) {
+        constexpr size_t waitersCount { 1'000 };
+        uint64_t resumed { 0 };
+        for (uint64_t done = 0; done < ops; done += waitersCount)
+        {
+            AsyncManualResetEvent event;
+            for (size_t idx = 0; idx < waitersCount; ++idx) {
+                spawn(eventWaiter(event, resumed));
+            }
+            event.set();
+        }
+        doNotOptimize(resumed);
+    });
+
+    /** One op: one hand-over between two coroutines, each resumed on the pool **/
+    suite.run("sync/auto_event_ping_pong", [&pool](const uint64_t ops) {
+        AsyncAutoResetEvent ping { false, &pool }, pong { false, &pool };
+        auto player = [](ThreadPool& workers, AsyncAutoResetEvent& wait, AsyncAutoResetEvent& signal,
+                         const uint64_t rounds, const bool serves) -> Task<> {
+            co_await workers.schedule();
+            for (uint64_t i = 0; i < rounds; ++i)
+            {
+                if (serves) {
+                    signal.set();
+                    co_await wait;
+                } else {
+                    co_await wait;
+                    signal.set();
+                }
+            }
+        };
+        std::vector<Task<>> players;
+        players.push_back(player(pool, pong, ping, ops, true));
+        players.push_back(player(pool, ping, pong, ops, false));
+        syncWait(whenAll(std::move(players)));
+    });
+}
@@ -0,0 +1,110 @@
+/**============================================================================
+Name        : Timers.cpp
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : 10k concurrent sleepers: CPU time burnt and wakeup lateness
+============================================================================**/
+
+#include "Benchmarks.h"
+#include "runtime/AsyncEvent.h"
+#include "runtime/Task.h"
+#include "runtime/Timeout.h"
+#include "runtime/TimerService.h"
+
+#include <algorithm>
+#include <format>
+#include <vector>
+
+#include <sys/resource.h>
+
+namespace
+{
+    using namespace StdCoroutines::Runtime;
+    using namespace std::chrono_literals;
+
+    std::chrono::microseconds cpuTime()
+    {
+        rusage usage {};
+        ::getrusage(RUSAGE_SELF, &usage);
+        return std::chrono::seconds { usage.ru_utime.tv_sec + usage.ru_stime.tv_sec } +
+               std::chrono::microseconds { usage.ru_utime.tv_usec + usage.ru_stime.tv_usec };
+    }
+
+    Task<> timerSleeper(const Clock::duration duration, Clock::duration& lateness)
+    {
+        const Clock::time_point deadline = Clock::now() + duration;
+        co_await sleep_for(duration);
+        lateness = Clock::now() - deadline;
+    }
+
+    /** What TinyCoro::Examples::Sleep used to do: re-queue itself until the time has passed **/
+    Task<> spinningSleeper(const Clock::duration duration, Clock::duration& lateness)
+    {
+        const Clock::time_point deadline = Clock::now() + duration;
+        while (Clock::now() < deadline) {
+            co_await ThreadPool::shared().schedule();
+        }
+        lateness = Clock::now() - deadline;
+    }
+
+    template<typename Sleeper>
+    void runSleepers(StdCoroutines::Benchmarks::Suite& suite, const std::string_view kind, Sleeper sleeper)
+    {
+        constexpr size_t sleepers { 10'000 };
+        constexpr Clock::duration duration { 100ms };
+
+        const std::string name = std::format("timers/{}_{}_sleepers", kind, sleepers);
+        if (!suite.enabled(name)) {
+            return;
+        }
+
+        std::vector<Clock::duration> lateness(sleepers);
+        std::vector<Task<>> tasks;
+        tasks.reserve(sleepers);
+
+        const std::chrono::microseconds cpuBefore = cpuTime();
+        const Clock::time_point start = Clock::now();
+        for (size_t idx = 0; idx < sleepers; ++idx) {
+            tasks.push_back(sleeper(duration, lateness[idx]));
+        }
+        syncWait(whenAll(std::move(tasks)));
+        const Clock::duration wall = Clock::now() - start;
+        const std::chrono::microseconds cpu = cpuTime() - cpuBefore;
+
+        std::ranges::sort(lateness);
+        const auto micros = [](const Clock::duration value) {
+            return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(value).count()) / 1e3;
+        };
+
+        StdCoroutines::Benchmarks::Result result;
+        result.name = name;
+        result.operations = sleepers;
+        result.nsPerOp = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(cpu).count()) / sleepers;
+        result.extra["cpu_ms"] = static_cast<double>(cpu.count()) / 1e3;
+        result.extra["cpu_utilisation"] = static_cast<double>(cpu.count()) /
+            static_cast<double>(std::chrono::duration_cast<std::chrono::microseconds>(wall).count());
+        result.extra["late_p50_us"] = micros(lateness[sleepers / 2]);
+        result.extra["late_p99_us"] = micros(lateness[sleepers * 99 / 100]);
+        result.extra["late_max_us"] = micros(lateness.back());
+        suite.add(std::move(result));
+    }
+}
+
+/** ns/op here is CPU time per sleeper, not wall time **/
+void StdCoroutines::Benchmarks::Timers::Run(Suite& suite)
+{
+    runSleepers(suite, "sleep_for", timerSleeper);
+    runSleepers(suite, "spinning", spinningSleeper);
+
+    /** The price of the race when the awaited side wins at once: arm + cancel + child frame **/
+    suite.run("timers/with_timeout_event_already_set", [](const uint64_t ops) {
+        AsyncManualResetEvent ready { true };
+        syncWait([](AsyncManualResetEvent& event, const uint64_t rounds) -> Task<> {
+            for (uint64_t i = 0; i < rounds; ++i) {
+                co_await with_timeout(event, 1s);
+            }
+        }(ready, ops));
+    });
+}
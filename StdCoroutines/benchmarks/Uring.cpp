@@ -0,0 +1,280 @@
+/**============================================================================
+Name        : Uring.cpp
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : io_uring loop vs the epoll reactor (socket round trips) and vs pread (file reads)
+============================================================================**/
+
+#include "Benchmarks.h"
+#include "runtime/Reactor.h"
+#include "runtime/Task.h"
+#include "runtime/Uring.h"
+
+#include <array>
+#include <chrono>
+#include <cstdlib>
+#include <format>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace
+{
+    using namespace StdCoroutines::Runtime;
+    using StdCoroutines::Benchmarks::Suite;
+
+    constexpr size_t messageSize { 64 };
+    using Message = std::array<char, messageSize>;
+
+    /** ---------------------------- epoll baseline ---------------------------- **/
+
+    Task<> reactorReadFull(Socket& socket, Message& message, bool& ok)
+    {
+        size_t received { 0 };
+        while (received < message.size()) {
+            const ssize_t bytes = co_await socket.read(std::span { message }.subspan(received));
+            if (bytes <= 0) {
+                ok = false;
+                co_return;
+            }
+            received += static_cast<size_t>(bytes);
+        }
+        ok = true;
+    }
+
+    Task<> reactorEcho(Socket& socket, const uint64_t rounds)
+    {
+        Message message {};
+        bool ok { false };
+        for (uint64_t i = 0; i < rounds; ++i) {
+            co_await reactorReadFull(socket, message, ok);
+            if (!ok || co_await socket.writeAll(message) < 0)
+                break;
+        }
+    }
+
+    Task<> reactorClient(Reactor& reactor, Socket& socket, const uint64_t rounds, size_t& running)
+    {
+        Message message {};
+        bool ok { false };
+        for (uint64_t i = 0; i < rounds; ++i) {
+            if (co_await socket.writeAll(message) < 0)
+                break;
+            co_await reactorReadFull(socket, message, ok);
+            if (!ok)
+                break;
+        }
+        if (0 == --running) {
+            reactor.stop();
+        }
+    }
+
+    void reactorRoundTrips(const size_t pairs, const uint64_t ops)
+    {
+        Reactor reactor { 1024 };
+        std::vector<std::unique_ptr<Socket>> sockets;
+        size_t running { pairs };
+        const uint64_t rounds = std::max<uint64_t>(1, ops / pairs);
+
+        for (size_t idx = 0; idx < pairs; ++idx)
+        {
+            int fds[2] {};
+            ::socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0, fds);
+            Socket& server = *sockets.emplace_back(std::make_unique<Socket>(reactor, fds[0]));
+            Socket& client = *sockets.emplace_back(std::make_unique<Socket>(reactor, fds[1]));
+            spawn(reactorEcho(server, rounds));
+            spawn(reactorClient(reactor, client, rounds, running));
+        }
+        reactor.run();
+    }
+
+    /** ------------------------------- io_uring ------------------------------- **/
+
+    Task<> uringReadFull(Uring& ring, const int fd, Message& message, bool& ok)
+    {
+        size_t received { 0 };
+        while (received < message.size()) {
+            const int32_t bytes = co_await ring.read(fd, std::span { message }.subspan(received));
+            if (bytes <= 0) {
+                ok = false;
+                co_return;
+            }
+            received += static_cast<size_t>(bytes);
+        }
+        ok = true;
+    }
+
+    Task<> uringEcho(Uring& ring, const int fd, const uint64_t rounds)
+    {
+        Message message {};
+        bool ok { false };
+        for (uint64_t i = 0; i < rounds; ++i) {
+            co_await uringReadFull(ring, fd, message, ok);
+            if (!ok || co_await ring.write(fd, message) < 0)
+                break;
+        }
+    }
+
+    Task<> uringClient(Uring& ring, const int fd, const uint64_t rounds)
+    {
+        Message message {};
+        bool ok { false };
+        for (uint64_t i = 0; i < rounds; ++i) {
+            if (co_await ring.write(fd, message) < 0)
+                break;
+            co_await uringReadFull(ring, fd, message, ok);
+            if (!ok)
+                break;
+        }
+    }
+
+    Uring::Stats uringRoundTrips(const size_t pairs, const uint64_t ops, const bool sqPoll)
+    {
+        Uring ring { Uring::Options { .entries = 4096, .sqPoll = sqPoll } };
+        std::vector<int> fds(pairs * 2);
+        const uint64_t rounds = std::max<uint64_t>(1, ops / pairs);
+
+        for (size_t idx = 0; idx < pairs; ++idx)
+        {
+            ::socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, &fds[idx * 2]);
+            spawn(uringEcho(ring, fds[idx * 2], rounds));
+            spawn(uringClient(ring, fds[idx * 2 + 1], rounds));
+        }
+        ring.run();
+
+        for (const int fd: fds) {
+            ::close(fd);
+        }
+        return ring.stats();
+    }
+
+    /** Fixed operation count, timed once: the io_uring variants also report io_uring_enter() calls per operation **/
+    template<typename Workload>
+    void measure(Suite& suite, const std::string& name, const uint64_t ops, Workload workload)
+    {
+        if (!suite.enabled(name)) {
+            return;
+        }
+        workload(ops / 10);   // warm up
+
+        const auto start = std::chrono::steady_clock::now();
+        const std::optional<Uring::Stats> stats = workload(ops);
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+
+        StdCoroutines::Benchmarks::Result result;
+        result.name = name;
+        result.operations = ops;
+        result.nsPerOp = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()) / ops;
+        if (stats) {
+            result.extra["enters_per_op"] = static_cast<double>(stats->enterCalls) / ops;
+            result.extra["sqes_per_enter"] = stats->enterCalls > 0
+                    ? static_cast<double>(stats->submitted) / static_cast<double>(stats->enterCalls) : 0.0;
+        }
+        suite.add(std::move(result));
+    }
+
+    void roundTrips(Suite& suite, const size_t pairs)
+    {
+        constexpr uint64_t roundTripsCount { 200'000 };
+
+        measure(suite, std::format("uring/round_trip_{}_pairs/epoll", pairs), roundTripsCount,
+                [pairs](const uint64_t ops) -> std::optional<Uring::Stats> {
+            reactorRoundTrips(pairs, ops);
+            return std::nullopt;
+        });
+
+        for (const bool sqPoll: { false, true })
+        {
+            measure(suite, std::format("uring/round_trip_{}_pairs/{}", pairs, sqPoll ? "io_uring_sqpoll" : "io_uring"),
+                    roundTripsCount, [pairs, sqPoll](const uint64_t ops) -> std::optional<Uring::Stats> {
+                return uringRoundTrips(pairs, ops, sqPoll);
+            });
+        }
+    }
+
+    /** ------------------------------ file reads ------------------------------ **/
+
+    constexpr size_t blockSize { 16 * 1024 };
+    constexpr size_t fileBlocks { 4096 };   // 64 MiB, read once up front so it is in the page cache
+
+    struct TempFile
+    {
+        std::string path { "/tmp/coro_bench_uring.dat" };
+        int fd { -1 };
+
+        TempFile()
+        {
+            fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0600);
+            std::vector<char> block(blockSize, 'x');
+            for (size_t idx = 0; idx < fileBlocks; ++idx) {
+                [[maybe_unused]] const auto bytes = ::write(fd, block.data(), block.size());
+            }
+            for (size_t idx = 0; idx < fileBlocks; ++idx) {
+                [[maybe_unused]] const auto bytes = ::pread(fd, block.data(), block.size(), idx * blockSize);
+            }
+        }
+
+        ~TempFile()
+        {
+            ::close(fd);
+            ::unlink(path.c_str());
+        }
+    };
+
+    /** Each reader owns one fixed buffer and walks every queueDepth-th block **/
+    Task<> fixedReader(Uring& ring, const size_t reader, const size_t queueDepth, const uint64_t blocks)
+    {
+        for (uint64_t block = reader; block < blocks; block += queueDepth) {
+            const int32_t bytes = co_await ring.readFixed(0, reader, blockSize, (block % fileBlocks) * blockSize);
+            if (bytes < 0)
+                break;
+        }
+    }
+
+    void fileReads(Suite& suite)
+    {
+        const TempFile file;
+        constexpr size_t queueDepth { 32 };
+
+        constexpr uint64_t blocksCount { 4 * fileBlocks };
+
+        measure(suite, "uring/file_read_16k/pread", blocksCount, [&file](const uint64_t ops) -> std::optional<Uring::Stats> {
+            std::vector<char> buffer(blockSize);
+            for (uint64_t block = 0; block < ops; ++block) {
+                [[maybe_unused]] const auto bytes = ::pread(file.fd, buffer.data(), blockSize, (block % fileBlocks) * blockSize);
+            }
+            return std::nullopt;
+        });
+
+        for (const bool sqPoll: { false, true })
+        {
+            const std::string name = std::format("uring/file_read_16k/{}", sqPoll ? "io_uring_sqpoll" : "io_uring");
+            measure(suite, name, blocksCount, [&file, sqPoll](const uint64_t ops) -> std::optional<Uring::Stats> {
+                Uring ring { Uring::Options { .entries = 64, .sqPoll = sqPoll } };
+                const int fds[] { file.fd };
+                ring.registerFiles(fds);
+                ring.registerBuffers(queueDepth, blockSize);
+                for (size_t reader = 0; reader < queueDepth; ++reader) {
+                    spawn(fixedReader(ring, reader, queueDepth, ops));
+                }
+                ring.run();
+                return ring.stats();
+            });
+        }
+    }
+}
+
+void StdCoroutines::Benchmarks::Uring::Run(Suite& suite)
+{
+    for (const size_t pairs: { 1, 64, 1024 }) {
+        roundTrips(suite, pairs);
+    }
+    fileReads(suite);
+}
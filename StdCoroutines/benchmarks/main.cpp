@@ -0,0 +1,58 @@
+/**============================================================================
+Name        : main.cpp
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : coro_bench [--json] [name-filter]
+============================================================================**/
+
+#include <vector>
+#include <string_view>
+
+#include "Benchmarks.h"
+
+
+int main([[maybe_unused]] int argc,
+         [[maybe_unused]] char** argv)
+{
+    const std::vector<std::string_view> args(argv + 1, argv + argc);
+
+    using namespace StdCoroutines::Benchmarks;
+
+    bool json { false };
+    std::string_view filter;
+    for (const std::string_view arg: args) {
+        if ("--json" == arg)
+            json = true;
+        else
+            filter = arg;
+    }
+
+    Suite suite { filter };
+
+    Coroutine_Primitives::Run(suite);
+    Event_Processor_Batching::Run(suite);
+    State_Machine::Run(suite);
+    Round_Robin::Run(suite);
+    Simulation::Run(suite);
+    Callback_Adapter::Run(suite);
+    Timers::Run(suite);
+    Echo_Server::Run(suite);
+    Uring::Run(suite);
+    File_Appender::Run(suite);
+    Shared_Mutex::Run(suite);
+    Sync_Primitives::Run(suite);
+    Single_Flight::Run(suite);
+    Async_Cache::Run(suite);
+    Blocking_Offload::Run(suite);
+    Priority_Scheduling::Run(suite);
+    Deadline_Scheduling::Run(suite);
+
+    if (json)
+        suite.printJson();
+    else
+        suite.printTable();
+
+    return EXIT_SUCCESS;
+}
@@ -8,6 +8,8 @@ Description : Calculating average
 ============================================================================**/
 
 #include "Experiments.h"
+#include "runtime/FrameStats.h"
+
 #include <iostream>
 
 
@@ -15,7 +17,7 @@ namespace
 {
     struct [[nodiscard]] Average
     {
-        struct promise_type
+        struct promise_type : StdCoroutines::Runtime::FrameStats::Tracked<Average>
         {
             Average get_return_object()
             {
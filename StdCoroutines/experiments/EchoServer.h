@@ -0,0 +1,463 @@
+/**============================================================================
+Name        : EchoServer.h
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Line echo server (coroutine per connection) + loopback load generator
+============================================================================**/
+
+#ifndef CPPCOROUTINES_ECHOSERVER_H
+#define CPPCOROUTINES_ECHOSERVER_H
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <coroutine>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "runtime/Reactor.h"
+#include "runtime/StateMachine.h"
+#include "runtime/Task.h"
+
+namespace StdCoroutines::Experiments::Echo_Server
+{
+    using namespace Runtime::StateMachine;
+
+    enum class ConnectionState : uint8_t
+    {
+        Reading,
+        Writing,
+        Closed,
+        Count
+    };
+
+    enum class ConnectionEvent : uint8_t
+    {
+        Partial,       // read something, no complete line yet
+        LineReceived,  // at least one '\n' terminated line is buffered
+        Flushed,       // every complete line was echoed back
+        PeerClosed,
+        Failed,
+        Count
+    };
+
+    constexpr TransitionTable<ConnectionState, ConnectionEvent> connectionTable {
+        ConnectionState::Reading, {
+            { ConnectionState::Reading, ConnectionEvent::Partial,      ConnectionState::Reading },
+            { ConnectionState::Reading, ConnectionEvent::LineReceived, ConnectionState::Writing },
+            { ConnectionState::Reading, ConnectionEvent::PeerClosed,   ConnectionState::Closed  },
+            { ConnectionState::Reading, ConnectionEvent::Failed,       ConnectionState::Closed  },
+            { ConnectionState::Writing, ConnectionEvent::Flushed,      ConnectionState::Reading },
+            { ConnectionState::Writing, ConnectionEvent::Failed,       ConnectionState::Closed  },
+        }
+    };
+
+    /**
+     * Accepts on a listening descriptor and runs one coroutine per connection on 'reactor'.
+     * Each connection coroutine walks connectionTable: read until a line is complete, echo
+     * every complete line, repeat. shutdown() is thread safe: the accept loop ends, and the
+     * reactor is stopped once the last open connection has been closed by its peer.
+     * Out of descriptors, pending connections are accepted on the reserve descriptor and
+     * closed at once, then the accept loop waits for the next connection to arrive (accept4()
+     * keeps reporting EMFILE even with nothing to accept); without a reserve it waits for one
+     * of our connections to close.
+    **/
+    class EchoServer
+    {
+        static constexpr size_t bufferSize { 4096 };
+
+        Runtime::Reactor& reactor;
+        Runtime::Socket listener;
+        int reserveFd { -1 };
+        std::coroutine_handle<> parkedAccept {};
+        size_t active { 0 };
+        bool accepting { false };
+
+        /** The accept loop parks here until a connection has closed its descriptor **/
+        struct DescriptorFreed
+        {
+            EchoServer& server;
+
+            [[nodiscard]]
+            bool await_ready() const noexcept {
+                /** TRUE ==> await_resume() or in case FALSE ==> await_suspend() will be called **/
+                return false;
+            }
+
+            void await_suspend(const std::coroutine_handle<> hInputCoro) const noexcept {
+                server.parkedAccept = hInputCoro;
+            }
+
+            void await_resume() const noexcept {
+            }
+        };
+
+        static int openReserve() noexcept {
+            return ::open("/dev/null", O_RDONLY | O_CLOEXEC);
+        }
+
+        /** EMFILE / ENFILE: drops every pending connection. false - no reserve to do it with **/
+        bool shedBacklog() noexcept
+        {
+            if (reserveFd < 0 && (reserveFd = openReserve()) < 0) {
+                return false;
+            }
+            ::close(reserveFd);
+            for (int fd; (fd = ::accept4(listener.descriptor(), nullptr, nullptr, SOCK_CLOEXEC)) >= 0; ) {
+                ::close(fd);
+            }
+            reserveFd = openReserve();
+            return true;
+        }
+
+        void stopWhenIdle() noexcept
+        {
+            if (!accepting && 0 == active) {
+                reactor.stop();
+            }
+        }
+
+        Runtime::Task<> echoLines(const int fd)
+        {
+            Runtime::Socket socket { reactor, fd };
+            std::array<char, bufferSize> buffer {};
+            size_t used { 0 }, lineEnd { 0 };
+
+            ConnectionState state = connectionTable.initial;
+            while (ConnectionState::Closed != state)
+            {
+                ConnectionEvent event { ConnectionEvent::Failed };
+                if (ConnectionState::Reading == state)
+                {
+                    const ssize_t bytes = co_await socket.read(std::span { buffer }.subspan(used));
+                    if (bytes > 0)
+                    {
+                        const std::string_view fresh { buffer.data() + used, static_cast<size_t>(bytes) };
+                        used += static_cast<size_t>(bytes);
+                        if (const size_t newLine = fresh.rfind('\n'); std::string_view::npos != newLine) {
+                            lineEnd = used - fresh.size() + newLine + 1;
+                            event = ConnectionEvent::LineReceived;
+                        } else {
+                            /** A line longer than the buffer is a protocol error **/
+                            event = (used < buffer.size()) ? ConnectionEvent::Partial : ConnectionEvent::Failed;
+                        }
+                    }
+                    else {
+                        event = (0 == bytes) ? ConnectionEvent::PeerClosed : ConnectionEvent::Failed;
+                    }
+                }
+                else if (ConnectionState::Writing == state)
+                {
+                    const ssize_t bytes = co_await socket.writeAll(std::span { buffer.data(), lineEnd });
+                    if (bytes >= 0)
+                    {
+                        std::memmove(buffer.data(), buffer.data() + lineEnd, used - lineEnd);
+                        used -= lineEnd;
+                        event = ConnectionEvent::Flushed;
+                    }
+                }
+                state = connectionTable.target(state, event);
+            }
+        }
+
+        Runtime::Task<> serve(const int fd)
+        {
+            co_await echoLines(fd);
+
+            /** The connection's descriptor is closed by now **/
+            --active;
+            if (parkedAccept) {
+                std::exchange(parkedAccept, nullptr).resume();
+            }
+            stopWhenIdle();
+        }
+
+        Runtime::Task<> acceptLoop()
+        {
+            while (true)
+            {
+                const ssize_t fd = co_await listener.accept();
+                if (fd < 0) {
+                    if (-ECONNABORTED == fd)
+                        continue;
+                    if (-EMFILE != fd && -ENFILE != fd)
+                        break;
+
+                    /** Retrying accept4() right away would fail again and again: spinning, not serving **/
+                    if (shedBacklog()) {
+                        co_await listener.readable();
+                    } else if (0 == active) {
+                        break;
+                    } else {
+                        co_await DescriptorFreed { *this };
+                    }
+                    continue;
+                }
+                ++active;
+                Runtime::spawn(serve(static_cast<int>(fd)));
+            }
+            accepting = false;
+            stopWhenIdle();
+        }
+
+    public:
+
+        /** Takes ownership of the listening descriptor **/
+        EchoServer(Runtime::Reactor& reactor, const int listenFd):
+                reactor { reactor }, listener { reactor, listenFd }, reserveFd { openReserve() } {
+        }
+
+        ~EchoServer()
+        {
+            if (reserveFd >= 0) {
+                ::close(reserveFd);
+            }
+        }
+
+        EchoServer(const EchoServer&) = delete;
+        EchoServer& operator=(const EchoServer&) = delete;
+
+        /** Must run on the reactor thread (or before it starts) **/
+        void start()
+        {
+            accepting = true;
+            Runtime::spawn(acceptLoop());
+        }
+
+        void shutdown() noexcept {
+            ::shutdown(listener.descriptor(), SHUT_RD);
+        }
+    };
+
+
+    /** Every loopback connection costs two descriptors in one process: lifts the soft limit to the hard one **/
+    inline void raiseDescriptorLimit() noexcept
+    {
+        rlimit limit {};
+        if (0 == ::getrlimit(RLIMIT_NOFILE, &limit) && limit.rlim_cur < limit.rlim_max) {
+            limit.rlim_cur = limit.rlim_max;
+            ::setrlimit(RLIMIT_NOFILE, &limit);
+        }
+    }
+
+
+    struct LoadStats
+    {
+        size_t connections { 0 };
+        size_t failedConnections { 0 };
+        size_t timedOutReads { 0 };
+        uint64_t requests { 0 };
+        std::chrono::nanoseconds elapsed { 0 };
+
+        /** Request round trip latencies, sorted **/
+        std::vector<uint32_t> latenciesNs;
+
+        [[nodiscard]]
+        double requestsPerSecond() const noexcept {
+            return elapsed.count() > 0 ? static_cast<double>(requests) * 1e9 / static_cast<double>(elapsed.count()) : 0.0;
+        }
+
+        [[nodiscard]]
+        double percentileUs(const double quantile) const noexcept
+        {
+            if (latenciesNs.empty())
+                return 0.0;
+            const auto idx = static_cast<size_t>(quantile * static_cast<double>(latenciesNs.size() - 1));
+            return latenciesNs[idx] / 1e3;
+        }
+    };
+
+    /**
+     * Opens 'connections' client sockets on its own reactor; once all of them are connected
+     * every client sends fixed size lines back to back, one outstanding request each,
+     * until 'duration' has passed. Runs on the calling thread. A response that does not
+     * arrive within 'responseTimeout' ends its client: a stuck server can't hang run().
+    **/
+    class LoadGenerator
+    {
+        using Clock = std::chrono::steady_clock;
+        static constexpr std::string_view request { "ping 0123456789\n" };
+        static constexpr std::chrono::milliseconds responseTimeout { 1000 };
+        static constexpr std::chrono::milliseconds watchEvery { 100 };
+
+        /** A client waiting for its response since 'since' (time_point::max() - not waiting) **/
+        struct ReadWatch
+        {
+            Runtime::Socket& socket;
+            size_t index { 0 };
+            Clock::time_point since { Clock::time_point::max() };
+            bool timedOut { false };
+        };
+
+        Runtime::Reactor reactor;
+        sockaddr_in server {};
+        size_t expected { 0 };
+        size_t pending { 0 };
+        Clock::time_point started {};
+        Clock::time_point deadline {};
+        std::vector<std::coroutine_handle<>> waitingForStart;
+        std::vector<ReadWatch*> watched;
+        LoadStats stats;
+
+        Clock::duration measureFor {};
+
+        /** Clients park here until the last one has connected, then the measured phase begins **/
+        struct StartGate
+        {
+            LoadGenerator& generator;
+
+            [[nodiscard]]
+            bool await_ready() const
+            {
+                /** TRUE ==> await_resume() or in case FALSE ==> await_suspend() will be called **/
+                if (generator.waitingForStart.size() + generator.stats.failedConnections + 1 < generator.expected) {
+                    return false;
+                }
+                generator.open();
+                return true;
+            }
+
+            void await_suspend(const std::coroutine_handle<> hInputCoro) const {
+                generator.waitingForStart.push_back(hInputCoro);
+            }
+
+            void await_resume() const noexcept {
+            }
+        };
+
+        void open()
+        {
+            started = Clock::now();
+            deadline = started + measureFor;
+            for (const std::coroutine_handle<> client: std::exchange(waitingForStart, {})) {
+                client.resume();
+            }
+        }
+
+        void watch(ReadWatch& readWatch)
+        {
+            readWatch.index = watched.size();
+            watched.push_back(&readWatch);
+        }
+
+        void unwatch(const ReadWatch& readWatch) noexcept
+        {
+            watched[readWatch.index] = watched.back();
+            watched[readWatch.index]->index = readWatch.index;
+            watched.pop_back();
+        }
+
+        /** The pending read of an overdue client completes (with 0 or an error) on the next poll **/
+        void cutOffStalledReads() noexcept
+        {
+            const Clock::time_point now = Clock::now();
+            for (ReadWatch* readWatch: watched) {
+                if (!readWatch->timedOut && readWatch->since < now && now - readWatch->since > responseTimeout) {
+                    readWatch->timedOut = true;
+                    ::shutdown(readWatch->socket.descriptor(), SHUT_RDWR);
+                }
+            }
+        }
+
+        void finished() noexcept
+        {
+            if (0 == --pending) {
+                stats.elapsed = Clock::now() - started;
+                reactor.stop();
+            }
+        }
+
+        void connectionFailed()
+        {
+            if (waitingForStart.size() + ++stats.failedConnections == expected) {
+                open();
+            }
+            finished();
+        }
+
+        Runtime::Task<> client()
+        {
+            /** Out of descriptors (EMFILE / ENFILE past the hard limit): counted like a refused connect() **/
+            std::optional<Runtime::Socket> opened;
+            try {
+                opened.emplace(reactor, Runtime::tcpSocket());
+            } catch (const std::system_error&) {
+            }
+            if (!opened || co_await opened->connect(server) < 0) {
+                connectionFailed();
+                co_return;
+            }
+            Runtime::Socket& socket = *opened;
+            co_await StartGate { *this };
+
+            ReadWatch readWatch { socket };
+            watch(readWatch);
+
+            std::array<char, request.size()> response {};
+            while (Clock::now() < deadline)
+            {
+                const Clock::time_point sent = Clock::now();
+                if (co_await socket.writeAll(request) < 0) {
+                    break;
+                }
+                readWatch.since = sent;
+                size_t received { 0 };
+                while (received < response.size()) {
+                    const ssize_t bytes = co_await socket.read(std::span { response }.subspan(received));
+                    if (bytes <= 0)
+                        break;
+                    received += static_cast<size_t>(bytes);
+                }
+                readWatch.since = Clock::time_point::max();
+                if (received < response.size()) {
+                    stats.timedOutReads += readWatch.timedOut;
+                    break;
+                }
+                stats.latenciesNs.push_back(static_cast<uint32_t>(
+                        std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - sent).count()));
+                ++stats.requests;
+            }
+            unwatch(readWatch);
+            finished();
+        }
+
+    public:
+
+        LoadStats run(const sockaddr_in& address, const size_t connections, const Clock::duration duration)
+        {
+            server = address;
+            expected = pending = connections;
+            measureFor = duration;
+            stats = LoadStats {};
+            stats.connections = connections;
+            waitingForStart.reserve(connections);
+
+            for (size_t idx = 0; idx < connections; ++idx) {
+                Runtime::spawn(client());
+            }
+            while (reactor.runFor(watchEvery)) {
+                cutOffStalledReads();
+            }
+
+            std::ranges::sort(stats.latenciesNs);
+            return std::move(stats);
+        }
+    };
+}
+
+#endif //CPPCOROUTINES_ECHOSERVER_H
@@ -0,0 +1,57 @@
+/**============================================================================
+Name        : Echo_Server.cpp
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Coroutine per connection echo server on the epoll reactor
+============================================================================**/
+
+#include "Experiments.h"
+#include "EchoServer.h"
+
+#include <chrono>
+#include <cstdint>
+#include <thread>
+
+namespace
+{
+    auto tid() { return std::this_thread::get_id();}
+    auto time() { return Utilities::getCurrentTime();}
+}
+
+namespace StdCoroutines::Experiments::Echo_Server
+{
+    using namespace std::chrono_literals;
+
+    void serveLoopback()
+    {
+        /** 1000 clients and the 1000 connections they are accepted on share this process **/
+        raiseDescriptorLimit();
+
+        const int listenFd = Runtime::listenTcp();
+        const sockaddr_in address = Runtime::localAddress(listenFd);
+
+        Runtime::Reactor serverReactor;
+        EchoServer server { serverReactor, listenFd };
+        server.start();
+        std::jthread serverThread { [&serverReactor] { serverReactor.run(); } };
+        std::println("[{}] [{}] echo server listening on 127.0.0.1:{}", tid(), time(), ntohs(address.sin_port));
+
+        LoadGenerator generator;
+        const LoadStats stats = generator.run(address, 1'000, 1s);
+        std::println("[{}] [{}] {} connections ({} failed, {} timed out): {} requests, {:.0f} req/s, "
+                     "p50 {:.1f} us, p99 {:.1f} us, p999 {:.1f} us", tid(), time(),
+                     stats.connections, stats.failedConnections, stats.timedOutReads,
+                     stats.requests, stats.requestsPerSecond(),
+                     stats.percentileUs(0.5), stats.percentileUs(0.99), stats.percentileUs(0.999));
+
+        /** Every client socket is closed by now: the server stops once it has seen all the EOFs **/
+        server.shutdown();
+    }
+}
+
+void StdCoroutines::Experiments::Echo_Server::TestAll()
+{
+    serveLoopback();
+}
@@ -0,0 +1,216 @@
+/**============================================================================
+Name        : EventQueue.h
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Event queue + handler coroutine of the Event_Processor experiment
+============================================================================**/
+
+#ifndef CPPCOROUTINES_EVENTQUEUE_H
+#define CPPCOROUTINES_EVENTQUEUE_H
+
+#include <algorithm>
+#include <coroutine>
+#include <cstddef>
+#include <deque>
+#include <iterator>
+#include <exception>
+#include <mutex>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "runtime/Logger.h"
+#include "runtime/FrameStats.h"
+#include "runtime/WaitEvent.h"
+
+namespace StdCoroutines::Experiments::Event_Processor
+{
+    struct Event
+    {
+        int id { 0 } ;
+        std::string data;
+    };
+
+    struct EventQueue
+    {
+        std::deque<Event> events;
+        std::mutex mutex;
+        bool closed { false };
+
+        /** Parks the consumer thread, producers wake it up - no polling **/
+        Runtime::WaitEvent readyEvent;
+
+        /** Touched only by the consumer thread **/
+        std::coroutine_handle<> waiter {};
+        std::vector<Event> batch;
+
+        /** co_await queue.next_batch(maxCount) **/
+        struct NextBatch
+        {
+            EventQueue& queue;
+            size_t maxCount;
+        };
+
+        void push(Event event)
+        {
+            {
+                std::lock_guard lock { mutex };
+                events.push_back(std::move(event));
+            }
+            readyEvent.notify();
+        }
+
+        void close()
+        {
+            {
+                std::lock_guard lock { mutex };
+                closed = true;
+            }
+            readyEvent.notify();
+        }
+
+        [[nodiscard]]
+        bool ready()
+        {
+            std::lock_guard lock { mutex };
+            return !events.empty() || closed;
+        }
+
+        /** Returns Event {-1} once the queue is closed and drained **/
+        Event pop()
+        {
+            std::lock_guard lock { mutex };
+            if (!events.empty()) {
+                Event event = std::move(events.front());
+                events.pop_front();
+                return event;
+            }
+            return Event {-1, ""};
+        }
+
+        /** maxCount of 0 is rejected: its empty batch would read as "closed and drained" **/
+        [[nodiscard]]
+        NextBatch next_batch(const size_t maxCount)
+        {
+            if (0 == maxCount) {
+                throw std::invalid_argument("EventQueue::next_batch: maxCount must be positive");
+            }
+            return NextBatch { *this, maxCount };
+        }
+
+        /** Moves up to maxCount events into the consumer-owned batch. Empty span - closed and drained **/
+        std::span<Event> popBatch(const size_t maxCount)
+        {
+            batch.clear();
+            std::lock_guard lock { mutex };
+            const size_t count = std::min(maxCount, events.size());
+            std::move(events.begin(), events.begin() + static_cast<std::ptrdiff_t>(count), std::back_inserter(batch));
+            events.erase(events.begin(), events.begin() + static_cast<std::ptrdiff_t>(count));
+            return batch;
+        }
+
+        /** Consumer loop: sleeps in the kernel until notified, then resumes the waiting coroutine **/
+        void run(const std::coroutine_handle<> handler)
+        {
+            while (!handler.done())
+            {
+                readyEvent.wait();
+                if (waiter && ready()) {
+                    std::exchange(waiter, {}).resume();
+                }
+            }
+        }
+    };
+
+    struct EventHandlerCoro
+    {
+        template<typename Result, Result (*Resume)(EventQueue&, size_t)>
+        struct Awaiter
+        {
+            EventQueue& queue;
+            size_t maxCount { 1 };
+
+            [[nodiscard]]
+            bool await_ready() const
+            {
+                const bool ready = queue.ready();
+                Runtime::Log::debug("\t await_ready() --> {}", ready);
+
+                /** TRUE ==> await_resume() or in case FALSE ==> await_suspend() will be called **/
+                return ready;
+            }
+
+            void await_suspend(const std::coroutine_handle<> hInputCoro) const
+            {
+                /** Defines what happens when the coroutine is suspended:
+                 *  just remember who is waiting, EventQueue::run() resumes it when a producer notifies **/
+                queue.waiter = hInputCoro;
+            }
+
+            Result await_resume()
+            {
+                /** Defines what happens when the coroutine is resumed **/
+                return Resume(queue, maxCount);
+            }
+        };
+
+        static Event popOne(EventQueue& queue, size_t) {
+            return queue.pop();
+        }
+
+        static std::span<Event> popBatch(EventQueue& queue, const size_t maxCount) {
+            return queue.popBatch(maxCount);
+        }
+
+        struct promise_type : Runtime::FrameStats::Tracked<EventHandlerCoro>
+        {
+            EventHandlerCoro get_return_object()
+            {
+                Runtime::Log::debug("promise_type::get_return_object()");
+                return EventHandlerCoro { std::coroutine_handle<promise_type>::from_promise(*this) };
+            }
+
+            std::suspend_never initial_suspend() {
+                return {};
+            }
+
+            std::suspend_always final_suspend() noexcept {
+                return {};
+            }
+
+            void return_void() {}
+            void unhandled_exception() { std::terminate(); }
+
+            Awaiter<Event, &popOne> await_transform(EventQueue& queue) noexcept {
+                return { queue, 1 };
+            }
+
+            /** One resume hands over up to maxCount events, moved out of the queue **/
+            Awaiter<std::span<Event>, &popBatch> await_transform(const EventQueue::NextBatch request) noexcept {
+                return { request.queue, request.maxCount };
+            }
+        };
+
+        std::coroutine_handle<promise_type> coroHandle;
+
+        explicit EventHandlerCoro(const std::coroutine_handle<promise_type>& handle) : coroHandle { handle } {
+            Runtime::Log::debug("EventHandlerCoro() created");
+        }
+
+        EventHandlerCoro(const EventHandlerCoro&) = delete;
+        EventHandlerCoro& operator=(const EventHandlerCoro&) = delete;
+
+        ~EventHandlerCoro()
+        {
+            if (coroHandle) {
+                coroHandle.destroy();
+            }
+        }
+    };
+}
+
+#endif //CPPCOROUTINES_EVENTQUEUE_H
@@ -0,0 +1,67 @@
+/**============================================================================
+Name        : Event_Or_Timeout.cpp
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : "Event or timeout" with with_timeout(): no thread per awaiter, one resumption
+============================================================================**/
+
+#include "Experiments.h"
+#include "runtime/AsyncEvent.h"
+#include "runtime/Task.h"
+#include "runtime/Timeout.h"
+#include "runtime/TimerService.h"
+
+#include <chrono>
+#include <thread>
+
+namespace
+{
+    auto tid() { return std::this_thread::get_id();}
+    auto time() { return Utilities::getCurrentTime();}
+}
+
+namespace
+{
+    using namespace StdCoroutines::Runtime;
+    using namespace std::chrono_literals;
+
+    Task<> setAfter(AsyncManualResetEvent& event, const Clock::duration delay)
+    {
+        co_await sleep_for(delay);
+        std::println("[{}] [{}] event.set()", tid(), time());
+        event.set();
+    }
+
+    Task<> demo()
+    {
+        /** The event wins: the timer is cancelled, the caller continues where set() was called **/
+        AsyncManualResetEvent ready;
+        spawn(setAfter(ready, 100ms));
+        const bool signalled = co_await with_timeout(ready, 1s);
+        std::println("[{}] [{}] event within 1s: {}", tid(), time(), signalled);
+
+        /** The timer wins: the losing wait is unlinked from the event, nothing stays behind **/
+        AsyncManualResetEvent never;
+        const bool signalledToo = co_await with_timeout(never, 200ms);
+        std::println("[{}] [{}] event within 200ms: {}", tid(), time(), signalledToo);
+
+        /** A timed-out wait on an auto-reset event does not swallow the next set() **/
+        AsyncAutoResetEvent turn;
+        const bool first = co_await with_timeout(turn, 50ms);
+        turn.set();
+        const bool second = co_await with_timeout(turn, 50ms);
+        std::println("[{}] [{}] auto-reset: first {}, after set() {}", tid(), time(), first, second);
+
+        /** sleep_for() is cancellable: losing the race wakes it at once instead of after 10s **/
+        co_await with_timeout(sleep_for(10s), 100ms);
+        std::println("[{}] [{}] 10s sleep cut to 100ms, timers pending: {}", tid(), time(),
+                     TimerService::shared().pending());
+    }
+}
+
+void StdCoroutines::Experiments::Event_Or_Timeout::TestAll()
+{
+    syncWait(demo());
+}
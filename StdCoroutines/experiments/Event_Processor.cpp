@@ -8,18 +8,26 @@ Description :
 ============================================================================**/
 
 #include "Experiments.h"
+#include "EventQueue.h"
+#include "runtime/Logger.h"
+#include "runtime/Task.h"
+#include "runtime/Uring.h"
+
+#include <array>
 #include <chrono>
+#include <cstring>
+#include <format>
 #include <thread>
-#include <queue>
 #include <iostream>
-#include <thread>
 #include <fstream>
 #include <source_location>
 
+#include <fcntl.h>
+#include <unistd.h>
+
 namespace
 {
-    auto tid() { return std::this_thread::get_id();}
-    auto time() { return Utilities::getCurrentTime();}
+    namespace Log = StdCoroutines::Runtime::Log;
 
     void log(const std::string_view message,
              const std::source_location location = std::source_location::current())
@@ -32,109 +40,101 @@ namespace
 
 namespace
 {
-    struct Event
-    {
-        int id { 0 } ;
-        std::string data;
-    };
+    using namespace StdCoroutines::Experiments::Event_Processor;
 
-    struct EventQueue
+    EventHandlerCoro handleEvents(EventQueue& queue)
     {
-        std::queue<Event> events;
-
-        void push(const Event& event) {
-            events.push(event);
-        }
-
-        Event pop()
-        {
-            if (!events.empty()) {
-                Event event = events.front();
-                events.pop();
-                return event;
+        while (true) {
+            Event event = co_await queue;
+            if (event.id < 0) {
+                break;
             }
-            return Event {-1, ""};
+            Log::info("Handling Event({}, {})", event.id, event.data);
         }
-    };
+    }
 
-    struct EventHandlerCoro
+    /** One resume per batch instead of one per event **/
+    EventHandlerCoro handleBatches(EventQueue& queue, const size_t maxBatch)
     {
-        template<class PromiseType>
-        struct Awaiter
-        {
-            EventQueue& queue;
-
-            explicit Awaiter(EventQueue& q): queue {q} {
-                //std::println("[{}] [{}] \t Awaiter created", tid(), time());
+        while (true) {
+            const std::span<Event> events = co_await queue.next_batch(maxBatch);
+            if (events.empty()) {
+                break;
             }
+            Log::info("Handling batch of {} events [{} .. {}]", events.size(), events.front().id, events.back().id);
+        }
+    }
+}
 
-            ~Awaiter() {
-                //std::println("[{}] [{}] \t Awaiter closed", tid(), time());
-            }
+/** Same bursts, but the events cross a pipe and the handler awaits io_uring reads **/
+namespace Uring_Events
+{
+    using namespace StdCoroutines::Runtime;
 
-            [[nodiscard]]
-            bool await_ready() const
-            {
-                std::println("[{}] [{}] \t await_ready() --> {}", tid(), time(), !queue.events.empty());
+    struct Record
+    {
+        int32_t id { 0 };
+        char data[28] {};
+    };
 
-                /** TRUE ==> await_resume() or in case FALSE ==> await_suspend() will be called **/
-                return !queue.events.empty();
+    /** One completion carries as many records as the producer managed to write: batching for free **/
+    Task<> handleRecords(Uring& ring, const int fd)
+    {
+        std::array<Record, 64> records {};
+        char* const storage = reinterpret_cast<char*>(records.data());
+        size_t filled { 0 };
+        while (true)
+        {
+            const int32_t bytes = co_await ring.read(fd, std::span { storage + filled, sizeof(records) - filled });
+            if (bytes <= 0) {
+                break;
             }
-
-            void await_suspend(const std::coroutine_handle<PromiseType>& hInputCoro) const
+            filled += static_cast<size_t>(bytes);
+            const size_t complete = filled / sizeof(Record);
+            if (complete > 0)
             {
-                /** Defines what happens when the coroutine is suspended. **/
-                while (queue.events.empty()) {
-                    // std::cout << "waiting for event ..." << std::endl;
-                    std::this_thread::sleep_for(std::chrono::milliseconds(100u));
-                }
-                hInputCoro.resume();
+                Log::info("Handling batch of {} events [{} .. {}]", complete, records[0].id, records[complete - 1].id);
+                filled -= complete * sizeof(Record);
+                std::memmove(storage, storage + complete * sizeof(Record), filled);
             }
+        }
+    }
 
-            Event await_resume()
-            {
-                /** Defines what happens when the coroutine is resumed **/
-                return queue.pop();
-            }
-        };
+    void processBursts()
+    {
+        /** Ring first: a failing io_uring_setup() leaves no thread and no descriptors behind **/
+        Uring ring;
+        int fds[2] {};
+        if (::pipe2(fds, O_CLOEXEC) < 0) {
+            return;
+        }
 
-        struct promise_type
-        {
-            EventHandlerCoro get_return_object()
+        /** jthread: joined on unwind as well. 30 records fit in the pipe buffer, the writer never blocks **/
+        std::jthread burstProducer([writeFd = fds[1]]() {
+            for (int burst = 0; burst < 3; ++burst)
             {
-                std::println("[{}] [{}] promise_type::get_return_object()", tid(), time());
-                return EventHandlerCoro { std::coroutine_handle<promise_type>::from_promise(*this) };
-            }
-
-            std::suspend_never initial_suspend() {
-                return {};
-            }
-
-            std::suspend_always final_suspend() noexcept {
-                return {};
-            }
-
-            void return_void() {}
-            void unhandled_exception() { std::terminate(); }
-
-            Awaiter<promise_type> await_transform(EventQueue& queue) noexcept {
-                return Awaiter<promise_type>(queue);
+                std::array<Record, 10> records {};
+                for (int i = 0; i < 10; ++i) {
+                    records[i].id = burst * 10 + i;
+                    std::format_to_n(records[i].data, sizeof(records[i].data) - 1, "EventData{}", i);
+                }
+                [[maybe_unused]] const auto bytes = ::write(writeFd, records.data(), sizeof(records));
+                std::this_thread::sleep_for(std::chrono::milliseconds(100u));
             }
-        };
-
-        std::coroutine_handle<promise_type> coroHandle;
-
-        explicit EventHandlerCoro(const std::coroutine_handle<promise_type>& handle) : coroHandle { handle } {
-            std::println("[{}] [{}] EventHandlerCoro() created", tid(), time());
+            ::close(writeFd);
+        });
+
+        try {
+            spawn(handleRecords(ring, fds[0]));
+            ring.run();
+        } catch (...) {
+            burstProducer.join();
+            ::close(fds[0]);
+            throw;
         }
-    };
 
-    EventHandlerCoro handleEvents(EventQueue& queue)
-    {
-        while (true) {
-            Event event = co_await queue;
-            std::println("[{}] [{}] Handling Event({}, {})", tid(), time(), event.id, event.data);
-        }
+        burstProducer.join();
+        ::close(fds[0]);
     }
 }
 
@@ -147,9 +147,27 @@ void StdCoroutines::Experiments::Event_Processor::TestAll()
             queue.push({i, "EventData" + std::to_string(i)});
             std::this_thread::sleep_for(std::chrono::milliseconds(500u));
         }
+        queue.close();
     });
 
-    handleEvents(queue);
+    const EventHandlerCoro handler = handleEvents(queue);
+    queue.run(handler.coroHandle);
     eventProducer.join();
 
+    EventQueue batchQueue;
+    std::thread burstProducer([&batchQueue]() {
+        for (int burst = 0; burst < 3; ++burst) {
+            for (int i = 0; i < 10; ++i)
+                batchQueue.push({burst * 10 + i, "EventData" + std::to_string(i)});
+            std::this_thread::sleep_for(std::chrono::milliseconds(100u));
+        }
+        batchQueue.close();
+    });
+
+    const EventHandlerCoro batchHandler = handleBatches(batchQueue, 4);
+    batchQueue.run(batchHandler.coroHandle);
+    burstProducer.join();
+
+    Uring_Events::processBursts();
+    Log::flush();
 }
\ No newline at end of file
@@ -0,0 +1,93 @@
+/**============================================================================
+Name        : Executor_Affinity.cpp
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Where does a coroutine continue: schedule_on(), resume_on(), resume_on_origin()
+============================================================================**/
+
+#include "Experiments.h"
+#include "runtime/Executor.h"
+#include "runtime/Task.h"
+
+#include <chrono>
+#include <string_view>
+#include <thread>
+
+namespace
+{
+    auto tid() { return std::this_thread::get_id();}
+    auto time() { return Utilities::getCurrentTime();}
+}
+
+namespace
+{
+    using namespace StdCoroutines::Runtime;
+    using namespace std::chrono_literals;
+
+    ThreadPool* cpuPool { nullptr };
+    ThreadPool* ioPool { nullptr };
+
+    std::string_view where()
+    {
+        const ThreadPool* const pool = ThreadPool::current();
+        return pool == cpuPool ? "cpu pool" : pool == ioPool ? "io pool" : "foreign thread";
+    }
+
+    /** Like TaskCoordination's TaskAwaiter: the coroutine is resumed on a detached helper thread **/
+    struct DetachedSleep
+    {
+        std::chrono::milliseconds timeout;
+
+        [[nodiscard]]
+        bool await_ready() const noexcept {
+            /** TRUE ==> await_resume() or in case FALSE ==> await_suspend() will be called **/
+            return false;
+        }
+
+        void await_suspend(const std::coroutine_handle<> hInputCoro) const
+        {
+            std::thread([hInputCoro, timeout = timeout] {
+                std::this_thread::sleep_for(timeout);
+                hInputCoro.resume();
+            }).detach();
+        }
+
+        [[nodiscard]]
+        int await_resume() const noexcept {
+            return static_cast<int>(timeout.count());
+        }
+    };
+
+    Task<> request()
+    {
+        co_await schedule_on(*cpuPool);
+        std::println("[{}] [{}] start on the {}", tid(), time(), where());
+
+        co_await DetachedSleep { 50ms };
+        std::println("[{}] [{}] plain co_await: continues on a {}", tid(), time(), where());
+
+        co_await schedule_on(*cpuPool);
+        const int waited = co_await resume_on_origin(DetachedSleep { 50ms });
+        std::println("[{}] [{}] resume_on_origin() after {} ms: back on the {}", tid(), time(), waited, where());
+
+        /** Blocking style work belongs to the I/O threads, the heavy continuation to the CPU pool **/
+        co_await schedule_on(*ioPool);
+        std::println("[{}] [{}] schedule_on(io): {}", tid(), time(), where());
+        co_await resume_on(DetachedSleep { 20ms }, *cpuPool);
+        std::println("[{}] [{}] resume_on(cpu): {}", tid(), time(), where());
+
+        /** Already there: no hop, the frame stays on the same (cache hot) worker **/
+        co_await schedule_on(*cpuPool);
+        std::println("[{}] [{}] schedule_on(cpu) from the cpu pool: no hop, {}", tid(), time(), where());
+    }
+}
+
+void StdCoroutines::Experiments::Executor_Affinity::TestAll()
+{
+    ThreadPool cpu { 2 }, io { 1 };
+    cpuPool = &cpu;
+    ioPool = &io;
+    syncWait(request());
+}
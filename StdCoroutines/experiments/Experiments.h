@@ -25,6 +25,9 @@ namespace StdCoroutines::Experiments
     namespace State_Machine_Simple { void TestAll();}
     namespace FileReader { void TestAll(); }
     namespace TaskCoordination { void TestAll(); }
+    namespace Echo_Server { void TestAll(); }
+    namespace Event_Or_Timeout { void TestAll(); }
+    namespace Executor_Affinity { void TestAll(); }
 }
 
 #endif //CPPCOROUTINES_EXPERIMENTS_H
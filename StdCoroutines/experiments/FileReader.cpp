@@ -8,10 +8,18 @@ Description : Simple Coroutine Waitable
 ============================================================================**/
 
 #include "Experiments.h"
+#include "runtime/BlockingPool.h"
+#include "runtime/Task.h"
+#include "runtime/Uring.h"
 
 #include <thread>
 #include <fstream>
 #include <source_location>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <unistd.h>
 
 namespace
 {
@@ -120,8 +128,116 @@ namespace
     }
 }
 
+namespace Offloaded_FileReader
+{
+    using namespace StdCoroutines::Runtime;
+
+    /** getline() and the pacing sleep run on the blocking pool, the printing continues on the CPU pool **/
+    Task<> printLines(const std::string path)
+    {
+        std::ifstream file { path };
+        std::string line;
+        while (co_await offload_blocking([&file, &line] {
+            std::this_thread::sleep_for(std::chrono::milliseconds(100u));
+            return static_cast<bool>(std::getline(file, line));
+        }))
+        {
+            std::println("[{}] [{}] {}: {}", tid(), time(), path, line);
+        }
+    }
+
+    void processFiles(const std::vector<std::string>& paths)
+    {
+        std::vector<Task<>> readers;
+        for (const std::string& path: paths) {
+            readers.push_back(printLines(path));
+        }
+        syncWait(whenAll(std::move(readers)));
+    }
+}
+
+namespace Uring_FileReader
+{
+    using namespace StdCoroutines::Runtime;
+
+    constexpr uint32_t chunkSize { 64 * 1024 };
+
+    /** Reads the registered file 'fileIndex' into fixed buffer 'fileIndex' chunk by chunk, prints it line by line **/
+    Task<> printLines(Uring& ring, const unsigned fileIndex, const std::string_view path)
+    {
+        std::string pending;
+        uint64_t offset { 0 };
+        while (true)
+        {
+            const int32_t bytes = co_await ring.readFixed(fileIndex, fileIndex, chunkSize, offset);
+            if (bytes < 0) {
+                std::println("[{}] [{}] {}: read failed ({})", tid(), time(), path, -bytes);
+            }
+            if (bytes <= 0) {
+                break;
+            }
+            offset += static_cast<uint64_t>(bytes);
+            pending.append(ring.buffer(fileIndex).data(), static_cast<size_t>(bytes));
+
+            size_t lineStart { 0 };
+            for (size_t newLine = pending.find('\n'); std::string::npos != newLine; newLine = pending.find('\n', lineStart)) {
+                std::println("[{}] [{}] {}: {}", tid(), time(), path, std::string_view { pending }.substr(lineStart, newLine - lineStart));
+                lineStart = newLine + 1;
+            }
+            pending.erase(0, lineStart);
+        }
+        if (!pending.empty()) {
+            std::println("[{}] [{}] {}: {}", tid(), time(), path, pending);
+        }
+    }
+
+    /** All files are read concurrently: the reads of one loop iteration go to the kernel in one io_uring_enter() **/
+    void processFiles(const std::vector<std::string_view>& paths)
+    {
+        std::vector<int> fds;
+        std::vector<std::string_view> opened;
+        for (const std::string_view path: paths)
+        {
+            const int fd = ::open(std::string { path }.c_str(), O_RDONLY | O_CLOEXEC);
+            if (fd < 0) {
+                std::println("[{}] [{}] {}: can not open", tid(), time(), path);
+                continue;
+            }
+            fds.push_back(fd);
+            opened.push_back(path);
+        }
+
+        /** registerFiles() rejects an empty set: nothing to read anyway **/
+        if (fds.empty()) {
+            return;
+        }
+
+        const auto closeAll = [&fds] {
+            for (const int fd: fds) {
+                ::close(fd);
+            }
+        };
+
+        try {
+            Uring ring;
+            ring.registerFiles(fds);
+            ring.registerBuffers(fds.size(), chunkSize);
+            for (unsigned idx = 0; idx < fds.size(); ++idx) {
+                spawn(printLines(ring, idx, opened[idx]));
+            }
+            ring.run();
+        } catch (...) {
+            closeAll();
+            throw;
+        }
+        closeAll();
+    }
+}
+
 
 void StdCoroutines::Experiments::FileReader::TestAll()
 {
     processFiles();
+    Offloaded_FileReader::processFiles({ R"(../../data/file1.txt)", R"(../../data/file2.txt)" });
+    Uring_FileReader::processFiles({ R"(../../data/file1.txt)", R"(../../data/file2.txt)" });
 }
@@ -8,6 +8,8 @@ Description : Generic_TaskBased_Coroutine
 ============================================================================**/
 
 #include "Experiments.h"
+#include "runtime/FrameStats.h"
+
 #include <thread>
 #include <functional>
 #include <deque>
@@ -70,7 +72,7 @@ namespace
             }
         };
 
-        struct promise_type
+        struct promise_type : StdCoroutines::Runtime::FrameStats::Tracked<Task>
         {
             Task get_return_object() {
                 return Task(promise_handle_t::from_promise(*this));
@@ -8,6 +8,8 @@ Description :
 ============================================================================**/
 
 #include "Experiments.h"
+#include "runtime/FrameStats.h"
+#include "runtime/RoundRobin.h"
 
 namespace {
     using Utilities::getCurrentTime;
@@ -61,7 +63,7 @@ namespace
         std::coroutine_handle<promise_type> coroHandle;
     };
 
-    struct Pinball::promise_type
+    struct Pinball::promise_type : StdCoroutines::Runtime::FrameStats::Tracked<Pinball>
     {
         Pinball get_return_object()
         {
@@ -99,6 +101,36 @@ namespace
     }
 }
 
+namespace
+{
+    /** The same game, but a million players share the machine in round-robin **/
+    using StdCoroutines::Runtime::RoundRobin;
+
+    RoundRobin::Player makePlayer(RoundRobin& machine, const int turns, uint64_t& score)
+    {
+        for (int i = 0; i < turns; ++i)
+        {
+            ++score;
+            co_await machine.yield();
+        }
+    }
+
+    void tournament(const size_t players, const int turns)
+    {
+        RoundRobin machine;
+        machine.reserve(players);
+
+        uint64_t score { 0 };
+        for (size_t idx = 0; idx < players; ++idx) {
+            machine.spawn(makePlayer(machine, turns, score));
+        }
+
+        const RoundRobin::Stats stats = machine.run();
+        std::println("[{}] {} players, {} rounds, {} resumes, score {}: {:.2f} ns per resume",
+                     getCurrentTime(), players, stats.rounds, stats.resumes, score, stats.nsPerResume());
+    }
+}
+
 
 void StdCoroutines::Experiments::PinBall_Game::TestAll()
 {
@@ -107,4 +139,6 @@ void StdCoroutines::Experiments::PinBall_Game::TestAll()
     {
         std::println("[{}] My turn to play", getCurrentTime());
     }
+
+    tournament(1'000'000, 10);
 }
@@ -8,8 +8,10 @@ Description :
 ============================================================================**/
 
 #include "Experiments.h"
+#include "runtime/StateMachine.h"
 
 #include <chrono>
+#include <cstdint>
 #include <thread>
 #include <iostream>
 
@@ -191,8 +193,92 @@ namespace State_Stored_in_Coroutine
     }
 }
 
+
+namespace Compile_Time_Transition_Table
+{
+    using namespace StdCoroutines::Runtime::StateMachine;
+
+    enum class ConnectionState : uint8_t
+    {
+        Disconnected,
+        Connecting,
+        Connected,
+        Disconnecting,
+        Count
+    };
+
+    enum class ConnectionEvent : uint8_t
+    {
+        Connect,
+        Established,
+        Failed,
+        Close,
+        Closed,
+        Count
+    };
+
+    constexpr std::string_view toString(const ConnectionState state)
+    {
+        constexpr std::string_view names[] { "Disconnected", "Connecting", "Connected", "Disconnecting" };
+        return names[index(state)];
+    }
+
+    /** Validated while compiling: add a second { Connected, Close, ... } row and this no longer builds **/
+    constexpr TransitionTable<ConnectionState, ConnectionEvent> connectionTable {
+        ConnectionState::Disconnected, {
+            { ConnectionState::Disconnected,  ConnectionEvent::Connect,     ConnectionState::Connecting    },
+            { ConnectionState::Connecting,    ConnectionEvent::Established, ConnectionState::Connected     },
+            { ConnectionState::Connecting,    ConnectionEvent::Failed,      ConnectionState::Disconnected  },
+            { ConnectionState::Connected,     ConnectionEvent::Close,       ConnectionState::Disconnecting },
+            { ConnectionState::Connected,     ConnectionEvent::Failed,      ConnectionState::Disconnected  },
+            { ConnectionState::Disconnecting, ConnectionEvent::Closed,      ConnectionState::Disconnected  },
+        }
+    };
+
+    static_assert(connectionTable.accepts(ConnectionState::Connected, ConnectionEvent::Close));
+    static_assert(!connectionTable.accepts(ConnectionState::Disconnected, ConnectionEvent::Close));
+
+    using Connections = Machines<connectionTable>;
+
+    Behaviour<connectionTable> manageConnection(Connections& connections, const size_t idx)
+    {
+        while (true) {
+            const auto step = co_await connections.transitions(idx);
+            std::println("[{}] [{}] connection {}: {} --> {}", tid(), time(), step.machine,
+                         toString(step.from), toString(step.to));
+        }
+    }
+
+    void stepManyConnections()
+    {
+        constexpr size_t connectionsCount { 10'000 };
+        Connections connections { connectionsCount };
+
+        /** Only the first connection has a behaviour attached, the others are pure table machines **/
+        const Behaviour<connectionTable> observer = manageConnection(connections, 0);
+
+        std::vector<ConnectionEvent> events(connectionsCount);
+        constexpr ConnectionEvent script[] {
+            ConnectionEvent::Connect, ConnectionEvent::Established, ConnectionEvent::Close,
+            ConnectionEvent::Closed, ConnectionEvent::Connect, ConnectionEvent::Failed
+        };
+
+        for (size_t tick = 0; tick < std::size(script); ++tick)
+        {
+            for (size_t idx = 0; idx < connectionsCount; ++idx) {
+                /** Every 7th connection fails while connecting **/
+                const bool failing = (idx % 7 == 0) && ConnectionEvent::Established == script[tick];
+                events[idx] = failing ? ConnectionEvent::Failed : script[tick];
+            }
+            const size_t accepted = connections.step(events);
+            std::println("[{}] [{}] tick {}: {} of {} events accepted", tid(), time(), tick, accepted, connectionsCount);
+        }
+    }
+}
+
 void StdCoroutines::Experiments::State_Machine_Simple::    TestAll()
 {
     // State_Stored_in_Awaitable::manageConnection();
-    State_Stored_in_Coroutine::manageConnection();
+    // State_Stored_in_Coroutine::manageConnection();
+    Compile_Time_Transition_Table::stepManyConnections();
 }
@@ -8,13 +8,19 @@ Description : Simple Coroutine Waitable
 ============================================================================**/
 
 #include "Experiments.h"
+#include "runtime/Logger.h"
+#include "runtime/Simulation.h"
 
 #include <chrono>
+#include <mutex>
 #include <thread>
+#include <vector>
 #include <source_location>
 
 namespace
 {
+    namespace Log = StdCoroutines::Runtime::Log;
+
     auto tid() { return std::this_thread::get_id();}
     auto time() { return Utilities::getCurrentTime();}
 
@@ -28,6 +34,22 @@ namespace
 }
 namespace
 {
+    /** The threads carrying the delays: TestAll() joins them instead of guessing how long they take **/
+    std::mutex delayThreadsLock;
+    std::vector<std::thread> delayThreads;
+
+    void joinDelays()
+    {
+        std::vector<std::thread> threads;
+        {
+            const std::lock_guard lock { delayThreadsLock };
+            threads.swap(delayThreads);
+        }
+        for (std::thread& thread: threads) {
+            thread.join();
+        }
+    }
+
     struct Task
     {
         struct promise_type;
@@ -50,12 +72,14 @@ namespace
 
             void await_suspend(const std::coroutine_handle<promise_type>& coroHandle)
             {
-                std::println("[{}] [{}] TaskAwaiter::await_suspend(timeout: {})", tid(), time(), timeout.count());
-                std::thread([coroHandle, this]() {
+                Log::info("TaskAwaiter::await_suspend(timeout: {})", timeout.count());
+
+                const std::lock_guard lock { delayThreadsLock };
+                delayThreads.emplace_back([coroHandle, this]() {
                     std::this_thread::sleep_for(timeout);
-                    std::println("[{}] [{}] TaskAwaiter::await_suspend(timeout: {}) done ", tid(), time(), timeout.count());
+                    Log::info("TaskAwaiter::await_suspend(timeout: {}) done ", timeout.count());
                     coroHandle.resume();
-                }).detach();
+                });
             }
 
             void await_resume() {
@@ -78,7 +102,7 @@ namespace
 
             std::suspend_never final_suspend() noexcept
             {
-                std::println("[{}] [{}] Task::final_suspend()", tid(), time());
+                Log::info("Task::final_suspend()");
                 return {};
             }
 
@@ -102,18 +126,19 @@ namespace
 
     Task moveEntity(int id, int distance)
     {
-        std::println("[{}] [{}] Entity {} moving {} units", tid(), time(), id, distance);
+        Log::info("Entity {} moving {} units", id, distance);
         co_await std::chrono::milliseconds(500U * distance);
     }
 
     Task updateEntity(int id)
     {
-        std::println("[{}] [{}] Entity {} updating", tid(), time(), id);
+        Log::info("Entity {} updating", id);
         co_await std::chrono::milliseconds(500U);
     }
 
 
-    Task runSimulation()
+    /** Each call starts its coroutine right away: the delays run concurrently, one thread each **/
+    void runSimulation()
     {
         moveEntity(1, 5);
         updateEntity(1);
@@ -124,7 +149,72 @@ namespace
 }
 
 
+namespace Virtual_Time
+{
+    /** The same entities, but delays are virtual: 10'000 of them finish in milliseconds on one thread **/
+    using namespace StdCoroutines::Runtime::Simulation;
+    using namespace std::chrono_literals;
+
+    Process moveEntity(Simulator& sim, const int id, const int distance, const int steps)
+    {
+        for (int step = 0; step < steps; ++step) {
+            co_await sim.delay(500ms * distance);
+            co_await sim.delay(500ms);  // update
+        }
+        if (0 == id % 2'000) {
+            Log::info("Entity {} arrived at {} ms of virtual time", id,
+                      std::chrono::duration_cast<std::chrono::milliseconds>(sim.now()).count());
+        }
+    }
+
+    /** Crossing to the next region takes at least the lookahead, so regions can run in parallel **/
+    Process roamingEntity(Simulator& home, ParallelSimulation& world, const int id, const int steps)
+    {
+        Simulator* sim = &home;
+        for (int step = 0; step < steps; ++step)
+        {
+            co_await sim->delay(100ms * (1 + (id + step) % 5));
+            if (0 == step % 10) {
+                const size_t region = static_cast<size_t>(id + step) % world.size();
+                sim = &co_await sim->migrate(world.partition(region), world.lookahead());
+            }
+        }
+    }
+
+    void runSimulation()
+    {
+        constexpr int entities { 10'000 }, steps { 100 };
+
+        Simulator sim;
+        sim.reserve(entities);
+        for (int id = 0; id < entities; ++id) {
+            sim.spawn(moveEntity(sim, id, 1 + id % 5, steps));
+        }
+        const Stats stats = sim.run();
+        Log::info("Sequential: {} events, {} ms virtual, {} ms wall, {:.1f} M events/sec", stats.events,
+                  std::chrono::duration_cast<std::chrono::milliseconds>(stats.virtualTime).count(),
+                  std::chrono::duration_cast<std::chrono::milliseconds>(stats.wallTime).count(),
+                  stats.eventsPerSecond() / 1e6);
+
+        ParallelSimulation world { 4, 200ms };
+        for (int id = 0; id < entities; ++id) {
+            Simulator& home = world.partition(static_cast<size_t>(id) % world.size());
+            home.spawn(roamingEntity(home, world, id, steps));
+        }
+        const Stats parallel = world.run();
+        Log::info("Parallel ({} partitions): {} events in {} windows, {} ms wall, {:.1f} M events/sec", world.size(),
+                  parallel.events, parallel.windows,
+                  std::chrono::duration_cast<std::chrono::milliseconds>(parallel.wallTime).count(),
+                  parallel.eventsPerSecond() / 1e6);
+    }
+}
+
 void StdCoroutines::Experiments::TaskCoordination::TestAll()
 {
     runSimulation();
+    Virtual_Time::runSimulation();
+
+    /** The thread-per-delay entities may still be sleeping **/
+    joinDelays();
+    Log::flush();
 }
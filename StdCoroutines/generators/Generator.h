@@ -0,0 +1,86 @@
+/**============================================================================
+Name        : Generator.h
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Hand-rolled Generator<T> (shared by the examples and the benchmarks)
+============================================================================**/
+
+#ifndef CPPCOROUTINES_GENERATOR_H
+#define CPPCOROUTINES_GENERATOR_H
+
+#include <coroutine>
+#include <optional>
+#include <utility>
+
+#include "runtime/FrameStats.h"
+
+namespace StdCoroutines::Generators
+{
+    template <typename T>
+    struct Generator
+    {
+        using value_type = T;
+
+        struct promise_type : Runtime::FrameStats::Tracked<Generator>
+        {
+            Generator get_return_object() {
+                return Generator { *this };
+            }
+
+            std::suspend_always initial_suspend() noexcept {
+                return {};
+            }
+
+            std::suspend_always final_suspend() noexcept {
+                return {};
+            }
+
+            void unhandled_exception() {
+            }
+
+            void return_value(value_type t) noexcept {
+                value = t;
+            }
+
+            std::suspend_always yield_value(value_type val) {
+                value = std::move(val);
+                return {};
+            }
+
+            std::optional<value_type> value {};
+        };
+
+        [[nodiscard]]
+        bool has_next() const {
+            return !handle.done();
+        }
+
+        [[nodiscard]]
+        std::optional<value_type> next() {
+            handle.resume();
+            return handle.promise().value;
+        }
+
+        explicit Generator(promise_type& promise) :
+            handle { std::coroutine_handle<promise_type>::from_promise(promise) } {
+        }
+
+        Generator(Generator&& other) noexcept : handle { std::exchange(other.handle, {}) } {
+        }
+
+        Generator(const Generator&) = delete;
+        Generator& operator=(const Generator&) = delete;
+
+        ~Generator() noexcept {
+            if (handle) {
+                handle.destroy();
+            }
+        }
+
+        std::coroutine_handle<promise_type> handle;
+    };
+}
+
+#endif //CPPCOROUTINES_GENERATOR_H
@@ -8,6 +8,7 @@ Description : Coroutines - Generators
 ============================================================================**/
 
 #include "Generators.h"
+#include "Generator.h"
 
 #include <iostream>
 #include <string_view>
@@ -261,64 +262,7 @@ namespace StdCoroutines::Generators::Fibonacci_Sequence_Generator_2
 
 namespace StdCoroutines::Generators::Fibonacci_Sequence_Generator_3
 {
-
-    template <typename T>
-    struct Generator
-    {
-        using value_type = T;
-
-        struct promise_type
-        {
-            Generator get_return_object() {
-                return Generator { *this };
-            }
-
-            std::suspend_always initial_suspend() noexcept {
-                return {};
-            }
-
-            std::suspend_always final_suspend() noexcept {
-                return {};
-            }
-
-            void unhandled_exception() {
-            }
-
-            void return_value(value_type t) noexcept {
-                value = t;
-            }
-
-            std::suspend_always yield_value(value_type&& val) {
-                value = std::move(val);
-                return {};
-            }
-
-            std::optional<value_type> value {};
-        };
-
-        [[nodiscard]]
-        bool has_next() const {
-            return !handle.done();
-        }
-
-        [[nodiscard]]
-        std::optional<value_type> next() {
-            handle.resume();
-            return handle.promise().value;
-        }
-
-        explicit Generator(promise_type& promise) :
-            handle { std::coroutine_handle<promise_type>::from_promise(promise) } {
-        }
-
-        ~Generator() noexcept {
-            if (handle) {
-                handle.destroy();
-            }
-        }
-
-        std::coroutine_handle<promise_type> handle;
-    };
+    using StdCoroutines::Generators::Generator;
 
     Generator<int> fib(const int max_count)
     {
@@ -49,8 +49,11 @@ int main([[maybe_unused]] int argc,
     // Experiments::Event_Processor::TestAll();
     // Experiments::State_Machine_Simple::TestAll();
     // Experiments::Generic_TaskBased_Coroutine::TestAll();
-    // Experiments::FileReader::TestAll();        // <------------- Not working
-    // Experiments::TaskCoordination::TestAll();  // <------------- Not working
+    // Experiments::FileReader::TestAll();
+    // Experiments::TaskCoordination::TestAll();
+    // Experiments::Echo_Server::TestAll();
+    // Experiments::Event_Or_Timeout::TestAll();
+    // Experiments::Executor_Affinity::TestAll();
 
     // String_to_Integer_Parser::Test();
 
@@ -0,0 +1,80 @@
+/**============================================================================
+Name        : AllocationHook.cpp
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Global operator new counting hook
+============================================================================**/
+
+#include "AllocationHook.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+    std::atomic<uint64_t> globalCount { 0 };
+    std::atomic<uint64_t> globalBytes { 0 };
+
+    thread_local uint64_t threadCount { 0 };
+    thread_local uint64_t threadBytes { 0 };
+
+    void* allocate(const std::size_t size)
+    {
+        globalCount.fetch_add(1, std::memory_order_relaxed);
+        globalBytes.fetch_add(size, std::memory_order_relaxed);
+        ++threadCount;
+        threadBytes += size;
+        /** As the default operator new: the installed new_handler gets a chance to free memory **/
+        while (true)
+        {
+            if (void* ptr = std::malloc(size ? size : 1)) {
+                return ptr;
+            }
+            const std::new_handler handler = std::get_new_handler();
+            if (!handler) {
+                throw std::bad_alloc {};
+            }
+            handler();
+        }
+    }
+}
+
+void* operator new(const std::size_t size) {
+    return allocate(size);
+}
+
+void* operator new[](const std::size_t size) {
+    return allocate(size);
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+namespace StdCoroutines::Runtime::Allocations
+{
+    Stats global() noexcept
+    {
+        return Stats { globalCount.load(std::memory_order_relaxed), globalBytes.load(std::memory_order_relaxed) };
+    }
+
+    Stats thisThread() noexcept
+    {
+        return Stats { threadCount, threadBytes };
+    }
+}
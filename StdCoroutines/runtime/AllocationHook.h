@@ -0,0 +1,51 @@
+/**============================================================================
+Name        : AllocationHook.h
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Global operator new counting hook
+============================================================================**/
+
+#ifndef CPPCOROUTINES_ALLOCATIONHOOK_H
+#define CPPCOROUTINES_ALLOCATIONHOOK_H
+
+#include <cstdint>
+
+/**
+ * AllocationHook.cpp replaces the global operator new/delete for the whole binary it is linked
+ * into: every object referencing operator new pulls it in, called functions below or not. So it
+ * is a library of its own, coro_allocation_hook, linked only by the benchmark harness - the
+ * runtime and the applications keep the default allocator and its uncontended fast path.
+**/
+namespace StdCoroutines::Runtime::Allocations
+{
+    struct Stats
+    {
+        uint64_t count { 0 };
+        uint64_t bytes { 0 };
+    };
+
+    [[nodiscard]]
+    Stats global() noexcept;
+
+    [[nodiscard]]
+    Stats thisThread() noexcept;
+
+    /** Allocations made by the calling thread since construction **/
+    class Scope
+    {
+        Stats start { thisThread() };
+
+    public:
+
+        [[nodiscard]]
+        Stats delta() const noexcept
+        {
+            const Stats now = thisThread();
+            return Stats { now.count - start.count, now.bytes - start.bytes };
+        }
+    };
+}
+
+#endif //CPPCOROUTINES_ALLOCATIONHOOK_H
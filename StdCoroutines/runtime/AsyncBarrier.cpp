@@ -0,0 +1,52 @@
+/**============================================================================
+Name        : AsyncBarrier.cpp
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Reusable coroutine barrier: co_await barrier.arrive_and_wait() once per phase
+============================================================================**/
+
+#include "AsyncBarrier.h"
+
+namespace StdCoroutines::Runtime
+{
+    bool AsyncBarrier::ArriveAwaiter::await_suspend(const std::coroutine_handle<> hInputCoro)
+    {
+        continuation = hInputCoro;
+        nextWaiter = barrier.waiters.load(std::memory_order_relaxed);
+        while (!barrier.waiters.compare_exchange_weak(nextWaiter, this,
+                                                      std::memory_order_release, std::memory_order_relaxed)) {
+        }
+
+        /** Once counted, this awaiter may be resumed at any moment: don't touch it any more **/
+        if (1 != barrier.remaining.fetch_sub(1, std::memory_order_acq_rel)) {
+            return true;
+        }
+        barrier.completePhase(this);
+        return false;
+    }
+
+    void AsyncBarrier::arrive_and_drop()
+    {
+        expected.fetch_sub(1, std::memory_order_relaxed);
+        if (1 == remaining.fetch_sub(1, std::memory_order_acq_rel)) {
+            completePhase(nullptr);
+        }
+    }
+
+    void AsyncBarrier::completePhase(const ArriveAwaiter* self)
+    {
+        remaining.store(expected.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        completedPhases.fetch_add(1, std::memory_order_release);
+
+        ArriveAwaiter* waiter = waiters.exchange(nullptr, std::memory_order_acquire);
+        while (waiter) {
+            ArriveAwaiter* const next = waiter->nextWaiter;
+            if (waiter != self) {
+                pool.post(waiter);
+            }
+            waiter = next;
+        }
+    }
+}
@@ -0,0 +1,94 @@
+/**============================================================================
+Name        : AsyncBarrier.h
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Reusable coroutine barrier: co_await barrier.arrive_and_wait() once per phase
+============================================================================**/
+
+#ifndef CPPCOROUTINES_ASYNCBARRIER_H
+#define CPPCOROUTINES_ASYNCBARRIER_H
+
+#include <atomic>
+#include <coroutine>
+#include <cstdint>
+
+#include "runtime/ThreadPool.h"
+
+namespace StdCoroutines::Runtime
+{
+    /**
+     * Like std::barrier without the completion function. Each arriving coroutine links its
+     * awaiter into a lock-free stack and then counts itself down; the last one of the phase
+     * re-arms the counter, posts everybody else to the pool and carries on without suspending.
+     * Nobody can arrive for the next phase before that: the others are still suspended.
+    **/
+    class AsyncBarrier
+    {
+    public:
+
+        struct ArriveAwaiter : WorkItem
+        {
+            AsyncBarrier& barrier;
+            std::coroutine_handle<> continuation {};
+            ArriveAwaiter* nextWaiter { nullptr };
+
+            explicit ArriveAwaiter(AsyncBarrier& barrier) noexcept : WorkItem { nullptr, &resume }, barrier { barrier } {
+            }
+
+            [[nodiscard]]
+            bool await_ready() const noexcept {
+                /** TRUE ==> await_resume() or in case FALSE ==> await_suspend() will be called **/
+                return false;
+            }
+
+            bool await_suspend(std::coroutine_handle<> hInputCoro);
+
+            void await_resume() const noexcept {
+            }
+
+            static void resume(WorkItem* item) {
+                static_cast<ArriveAwaiter*>(item)->continuation.resume();
+            }
+        };
+
+    private:
+
+        /** Participants of the next phases (arrive_and_drop() lowers it) and the ones still missing in this one **/
+        std::atomic<int64_t> expected;
+        std::atomic<int64_t> remaining;
+        std::atomic<ArriveAwaiter*> waiters { nullptr };
+        std::atomic<uint64_t> completedPhases { 0 };
+
+        ThreadPool& pool;
+
+        /** Called by the last arrival: 'self' (if any) continues inline **/
+        void completePhase(const ArriveAwaiter* self);
+
+    public:
+
+        explicit AsyncBarrier(const int64_t participants, ThreadPool& pool = ThreadPool::shared()) noexcept :
+                expected { participants }, remaining { participants }, pool { pool } {
+        }
+
+        AsyncBarrier(const AsyncBarrier&) = delete;
+        AsyncBarrier& operator=(const AsyncBarrier&) = delete;
+
+        /** co_await barrier.arrive_and_wait(); **/
+        [[nodiscard]]
+        ArriveAwaiter arrive_and_wait() noexcept {
+            return ArriveAwaiter { *this };
+        }
+
+        /** Arrives for the current phase and leaves the barrier for good **/
+        void arrive_and_drop();
+
+        [[nodiscard]]
+        uint64_t phase() const noexcept {
+            return completedPhases.load(std::memory_order_acquire);
+        }
+    };
+}
+
+#endif //CPPCOROUTINES_ASYNCBARRIER_H
@@ -0,0 +1,273 @@
+/**============================================================================
+Name        : AsyncCache.h
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Sharded string keyed cache with CLOCK eviction: co_await cache.get_or_load(key, loader)
+============================================================================**/
+
+#ifndef CPPCOROUTINES_ASYNCCACHE_H
+#define CPPCOROUTINES_ASYNCCACHE_H
+
+#include <atomic>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "runtime/SharedTask.h"
+#include "runtime/Task.h"
+
+namespace StdCoroutines::Runtime
+{
+    /**
+     * Keys are spread over lock-striped shards, each a hash map into a fixed ring of slots
+     * evicted with CLOCK: a hit only sets the slot's 'referenced' bit, nothing is relinked.
+     * get_or_load() completes without suspending on a hit. A miss stores a SharedTask running
+     * 'loader' in the slot, so concurrent misses for one key await that single load.
+     * Slots with a load in flight are never evicted; a failed load is dropped (the next
+     * request retries). Values are copied out: use a shared_ptr Value for large objects.
+    **/
+    template<typename Value>
+    class AsyncCache
+    {
+    public:
+
+        struct Stats
+        {
+            uint64_t hits { 0 };
+            uint64_t misses { 0 };     // loads started
+            uint64_t joins { 0 };      // requests that awaited a load already in flight
+            uint64_t evictions { 0 };
+        };
+
+    private:
+
+        static constexpr size_t cacheLineSize { 64 };
+        static constexpr uint32_t noSlot { ~uint32_t { 0 } };
+
+        struct StringHash
+        {
+            using is_transparent = void;
+
+            size_t operator()(const std::string_view key) const noexcept {
+                return std::hash<std::string_view> {}(key);
+            }
+        };
+
+        struct Slot
+        {
+            std::string key;
+            SharedTask<Value> value;
+            uint64_t generation { 0 };
+            bool occupied { false };
+            bool referenced { false };
+        };
+
+        struct alignas(cacheLineSize) Shard
+        {
+            std::mutex mutex;
+            std::unordered_map<std::string, uint32_t, StringHash, std::equal_to<>> index;
+            std::vector<Slot> slots;
+            uint32_t used { 0 };
+            uint32_t hand { 0 };
+            uint64_t generations { 0 };
+            Stats stats;
+
+            /** With 'mutex' held. noSlot - every slot has a load in flight **/
+            [[nodiscard]]
+            uint32_t freeSlot(SharedTask<Value>& evicted)
+            {
+                if (used < slots.size()) {
+                    return used++;
+                }
+                for (size_t step = 0; step < 2 * slots.size(); ++step)
+                {
+                    const uint32_t candidate = hand;
+                    hand = (hand + 1) % static_cast<uint32_t>(slots.size());
+                    Slot& slot = slots[candidate];
+                    if (std::exchange(slot.referenced, false) || !slot.value.isReady()) {
+                        continue;
+                    }
+                    if (slot.occupied) {
+                        index.erase(slot.key);
+                        evicted = std::move(slot.value);
+                        slot.occupied = false;
+                        ++stats.evictions;
+                    }
+                    return candidate;
+                }
+                return noSlot;
+            }
+
+            void forget(const std::string_view key, const uint64_t generation)
+            {
+                SharedTask<Value> dropped;
+                std::lock_guard lock { mutex };
+                if (const auto iter = index.find(key); index.end() != iter)
+                {
+                    Slot& slot = slots[iter->second];
+                    if (generation == slot.generation) {
+                        dropped = std::move(slot.value);
+                        slot.occupied = false;
+                        slot.referenced = false;
+                        index.erase(iter);
+                    }
+                }
+            }
+        };
+
+        std::unique_ptr<Shard[]> shards;
+        size_t shardsMask { 0 };
+
+        template<typename Loader>
+        static SharedTask<Value> load(Shard& shard, std::string key, const uint64_t generation, Loader loader)
+        {
+            try {
+                co_return co_await loader(key);
+            } catch (...) {
+                shard.forget(key, generation);
+                throw;
+            }
+        }
+
+        [[nodiscard]]
+        Shard& shardOf(const std::string_view key) const noexcept {
+            return shards[StringHash {}(key) & shardsMask];
+        }
+
+    public:
+
+        /** Hit: the value is already in 'hit'. Otherwise the shared load to wait for **/
+        class [[nodiscard]] GetAwaiter
+        {
+            std::optional<Value> hit;
+            SharedTask<Value> pending;
+            typename SharedTask<Value>::Awaiter awaiter;
+
+        public:
+
+            explicit GetAwaiter(Value value): hit { std::move(value) }, awaiter { pending.operator co_await() } {
+            }
+
+            explicit GetAwaiter(SharedTask<Value> task):
+                    pending { std::move(task) }, awaiter { pending.operator co_await() } {
+            }
+
+            [[nodiscard]]
+            bool await_ready() const noexcept {
+                /** TRUE ==> await_resume() or in case FALSE ==> await_suspend() will be called **/
+                return hit || awaiter.await_ready();
+            }
+
+            std::coroutine_handle<> await_suspend(const std::coroutine_handle<> hInputCoro) noexcept {
+                return awaiter.await_suspend(hInputCoro);
+            }
+
+            Value await_resume()
+            {
+                if (hit) {
+                    return std::move(*hit);
+                }
+                return awaiter.await_resume();
+            }
+        };
+
+        /** 'shardsCount' is rounded up to a power of two; 'capacity' is split evenly between the shards **/
+        explicit AsyncCache(const size_t capacity, const size_t shardsCount = 16)
+        {
+            size_t count { 1 };
+            while (count < shardsCount)
+                count <<= 1;
+            shards = std::make_unique<Shard[]>(count);
+            shardsMask = count - 1;
+            for (size_t idx = 0; idx < count; ++idx) {
+                shards[idx].slots.resize(std::max<size_t>(1, (capacity + count - 1) / count));
+                shards[idx].index.reserve(shards[idx].slots.size());
+            }
+        }
+
+        AsyncCache(const AsyncCache&) = delete;
+        AsyncCache& operator=(const AsyncCache&) = delete;
+
+        /** const Value value = co_await cache.get_or_load(key, [](const std::string& key) -> Task<Value> {...}); **/
+        template<typename Loader>
+        GetAwaiter get_or_load(const std::string_view key, Loader&& loader)
+        {
+            Shard& shard = shardOf(key);
+            SharedTask<Value> evicted;
+            std::lock_guard lock { shard.mutex };
+
+            if (const auto iter = shard.index.find(key); shard.index.end() != iter)
+            {
+                Slot& slot = shard.slots[iter->second];
+                slot.referenced = true;
+                if (slot.value.isReady()) {
+                    /** Completed: await_resume() of its awaiter just reads the stored value **/
+                    ++shard.stats.hits;
+                    return GetAwaiter { Value { slot.value.operator co_await().await_resume() } };
+                }
+                ++shard.stats.joins;
+                return GetAwaiter { slot.value };
+            }
+
+            ++shard.stats.misses;
+            const uint64_t generation = ++shard.generations;
+            SharedTask<Value> task = load(shard, std::string { key }, generation, std::forward<Loader>(loader));
+
+            /** Full of loads in flight: this one still runs, it is just not cached **/
+            if (const uint32_t slotIndex = shard.freeSlot(evicted); noSlot != slotIndex)
+            {
+                Slot& slot = shard.slots[slotIndex];
+                slot.key = key;
+                slot.value = task;
+                slot.generation = generation;
+                slot.occupied = true;
+                slot.referenced = false;
+                shard.index.emplace(slot.key, slotIndex);
+            }
+            return GetAwaiter { std::move(task) };
+        }
+
+        void invalidate(const std::string_view key)
+        {
+            Shard& shard = shardOf(key);
+            SharedTask<Value> dropped;
+            std::lock_guard lock { shard.mutex };
+            if (const auto iter = shard.index.find(key); shard.index.end() != iter)
+            {
+                Slot& slot = shard.slots[iter->second];
+                dropped = std::move(slot.value);
+                slot.occupied = false;
+                slot.referenced = false;
+                shard.index.erase(iter);
+            }
+        }
+
+        [[nodiscard]]
+        Stats stats() const
+        {
+            Stats total;
+            for (size_t idx = 0; idx <= shardsMask; ++idx)
+            {
+                std::lock_guard lock { shards[idx].mutex };
+                total.hits += shards[idx].stats.hits;
+                total.misses += shards[idx].stats.misses;
+                total.joins += shards[idx].stats.joins;
+                total.evictions += shards[idx].stats.evictions;
+            }
+            return total;
+        }
+    };
+}
+
+#endif //CPPCOROUTINES_ASYNCCACHE_H
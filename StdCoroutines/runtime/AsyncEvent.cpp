@@ -0,0 +1,348 @@
+/**============================================================================
+Name        : AsyncEvent.cpp
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Manual-reset and auto-reset events: any number of coroutines co_await them, waits are cancellable
+============================================================================**/
+
+#include "AsyncEvent.h"
+#include "Tracing.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace StdCoroutines::Runtime
+{
+    namespace
+    {
+        void resumeWaiter(EventWaiter* waiter, ThreadPool* pool)
+        {
+            Trace::record(waiter->continuation, Trace::Event::Scheduled, "AsyncEvent");
+            if (pool)
+                pool->post(waiter);
+            else
+                waiter->continuation.resume();
+        }
+
+        /** Newest first (as pushed) ==> oldest first **/
+        [[nodiscard]]
+        EventWaiter* reversed(EventWaiter* waiter) noexcept
+        {
+            EventWaiter* ordered = nullptr;
+            while (waiter) {
+                EventWaiter* const next = waiter->nextWaiter;
+                waiter->nextWaiter = ordered;
+                ordered = waiter;
+                waiter = next;
+            }
+            return ordered;
+        }
+    }
+
+    bool EventWaiter::markCancelled() noexcept
+    {
+        uint8_t old = status.load(std::memory_order_relaxed);
+        while (true)
+        {
+            const uint8_t phase = old & phaseMask;
+            if (idle != phase && waiting != phase) {
+                return false;
+            }
+            const uint8_t next = (old & ~phaseMask) | (idle == phase ? cancelledEarly : cancelled);
+            if (status.compare_exchange_weak(old, next, std::memory_order_acq_rel, std::memory_order_relaxed)) {
+                return waiting == phase;
+            }
+        }
+    }
+
+    uint8_t EventWaiter::release() noexcept
+    {
+        uint8_t old = status.load(std::memory_order_relaxed);
+        uint8_t next;
+        do {
+            const uint8_t phase = isLive(old) ? signalled : (old & phaseMask);
+            next = phase | (old & suspendedBit) | releasedBit;
+        } while (!status.compare_exchange_weak(old, next, std::memory_order_acq_rel, std::memory_order_relaxed));
+        return old;
+    }
+
+    void EventWaiter::resumeAll(EventWaiter* waiters, ThreadPool* pool)
+    {
+        while (waiters)
+        {
+            /** The frame holding 'waiters' may be gone once it has been resumed **/
+            EventWaiter* const next = waiters->nextWaiter;
+            resumeWaiter(waiters, pool);
+            waiters = next;
+        }
+    }
+
+    void EventWaiter::releaseAll(EventWaiter* waiters, ThreadPool* pool)
+    {
+        while (waiters)
+        {
+            /** Not suspended yet: its await_suspend() goes on by itself and the frame may go any moment **/
+            EventWaiter* const next = waiters->nextWaiter;
+            if (waiters->release() & suspendedBit) {
+                resumeWaiter(waiters, pool);
+            }
+            waiters = next;
+        }
+    }
+
+
+    bool AsyncManualResetEvent::Awaiter::await_suspend(const std::coroutine_handle<> hInputCoro) noexcept
+    {
+        continuation = hInputCoro;
+        if (isCancelled(status.load(std::memory_order_acquire))) {
+            return false;
+        }
+
+        uintptr_t old = event.state.load(std::memory_order_acquire);
+        do {
+            if (isSet == old) {
+                markSignalled();
+                return false;
+            }
+            nextWaiter = reinterpret_cast<EventWaiter*>(old);
+        } while (!event.state.compare_exchange_weak(old, reinterpret_cast<uintptr_t>(this),
+                                                    std::memory_order_release, std::memory_order_acquire));
+        return arrive([this] { event.purgeCancelled(); });
+    }
+
+    void AsyncManualResetEvent::Awaiter::cancel() noexcept
+    {
+        if (markCancelled()) {
+            event.purgeCancelled();
+        }
+    }
+
+    void AsyncManualResetEvent::set() noexcept
+    {
+        const uintptr_t old = state.exchange(isSet, std::memory_order_acq_rel);
+        if (isSet == old) {
+            return;
+        }
+
+        /** The stack is newest first: reverse it so waiters resume in arrival order **/
+        EventWaiter::releaseAll(reversed(reinterpret_cast<EventWaiter*>(old)), pool);
+    }
+
+    void AsyncManualResetEvent::reset() noexcept
+    {
+        uintptr_t expected { isSet };
+        state.compare_exchange_strong(expected, notSetNoWaiters, std::memory_order_relaxed);
+    }
+
+    void AsyncManualResetEvent::purgeCancelled() noexcept
+    {
+        if (0 != purgeRequests.fetch_add(1, std::memory_order_acq_rel)) {
+            return;
+        }
+
+        /** Released once the event is no longer touched: a resumed waiter may destroy it **/
+        ThreadPool* const workers = pool;
+        EventWaiter* released = nullptr;
+        uint32_t requests { 1 };
+        do
+        {
+            uintptr_t old = state.load(std::memory_order_acquire);
+            while (isSet != old && notSetNoWaiters != old &&
+                   !state.compare_exchange_weak(old, notSetNoWaiters, std::memory_order_acq_rel, std::memory_order_acquire)) {
+            }
+            if (isSet == old || notSetNoWaiters == old) {
+                continue;
+            }
+
+            EventWaiter* kept = nullptr;
+            EventWaiter** keptTail = &kept;
+            for (EventWaiter* waiter = reinterpret_cast<EventWaiter*>(old); waiter; )
+            {
+                EventWaiter* const next = waiter->nextWaiter;
+                if (EventWaiter::isCancelled(waiter->status.load(std::memory_order_acquire))) {
+                    waiter->nextWaiter = released;
+                    released = waiter;
+                } else {
+                    *keptTail = waiter;
+                    keptTail = &waiter->nextWaiter;
+                }
+                waiter = next;
+            }
+            if (!kept) {
+                continue;
+            }
+
+            /** Back on top of whoever arrived meanwhile; a set() in between has signalled them all **/
+            uintptr_t top = state.load(std::memory_order_acquire);
+            do {
+                if (isSet == top) {
+                    *keptTail = released;
+                    released = kept;
+                    break;
+                }
+                *keptTail = reinterpret_cast<EventWaiter*>(top);
+            } while (!state.compare_exchange_weak(top, reinterpret_cast<uintptr_t>(kept),
+                                                  std::memory_order_acq_rel, std::memory_order_acquire));
+        } while (!purgeRequests.compare_exchange_strong(requests, 0, std::memory_order_acq_rel, std::memory_order_acquire));
+
+        EventWaiter::releaseAll(released, workers);
+    }
+
+
+    bool AsyncAutoResetEvent::tryConsume() noexcept
+    {
+        uint64_t old = state.load(std::memory_order_relaxed);
+        while (setCount(old) > waiterCount(old)) {
+            if (state.compare_exchange_weak(old, old - setIncrement, std::memory_order_acquire, std::memory_order_relaxed)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool AsyncAutoResetEvent::Awaiter::await_suspend(const std::coroutine_handle<> hInputCoro) noexcept
+    {
+        continuation = hInputCoro;
+        if (isCancelled(status.load(std::memory_order_acquire))) {
+            return false;
+        }
+
+        /** Linked in before it is counted: whoever sees the count finds the awaiter **/
+        nextWaiter = event.newWaiters.load(std::memory_order_relaxed);
+        while (!event.newWaiters.compare_exchange_weak(nextWaiter, this,
+                                                       std::memory_order_release, std::memory_order_relaxed)) {
+        }
+        event.onStateAdded(event.state.fetch_add(waiterIncrement, std::memory_order_acq_rel), waiterIncrement);
+        return arrive([this] { event.requestPurge(); });
+    }
+
+    void AsyncAutoResetEvent::Awaiter::cancel() noexcept
+    {
+        if (markCancelled()) {
+            event.requestPurge();
+        }
+    }
+
+    void AsyncAutoResetEvent::set() noexcept
+    {
+        uint64_t old = state.load(std::memory_order_relaxed);
+        do {
+            if (setCount(old) > waiterCount(old)) {
+                return;
+            }
+        } while (!state.compare_exchange_weak(old, old + setIncrement, std::memory_order_acq_rel, std::memory_order_relaxed));
+        onStateAdded(old, setIncrement);
+    }
+
+    void AsyncAutoResetEvent::reset() noexcept
+    {
+        uint64_t old = state.load(std::memory_order_relaxed);
+        while (setCount(old) > waiterCount(old)) {
+            if (state.compare_exchange_weak(old, old - setIncrement, std::memory_order_relaxed)) {
+                return;
+            }
+        }
+    }
+
+    void AsyncAutoResetEvent::requestPurge() noexcept
+    {
+        onStateAdded(state.fetch_add(cancelIncrement, std::memory_order_acq_rel), cancelIncrement);
+    }
+
+    void AsyncAutoResetEvent::onStateAdded(const uint64_t old, const uint64_t increment) noexcept
+    {
+        if (!hasWork(old) && hasWork(old + increment)) {
+            resumeWaiters(old + increment);
+        }
+    }
+
+    void AsyncAutoResetEvent::resumeWaiters(uint64_t current) noexcept
+    {
+        /** Resumed once the event is no longer touched: a resumed waiter may destroy it **/
+        ThreadPool* const workers = pool;
+        EventWaiter* resumable = nullptr;
+        EventWaiter** resumableTail = &resumable;
+
+        do
+        {
+            /** Counted waiters are always linked in, so 'budget' of them are there to take **/
+            const uint32_t budget = waiterCount(current);
+            uint32_t taken { 0 }, matched { 0 };
+            const auto take = [&](EventWaiter* waiter) {
+                ++taken;
+                const uint8_t before = waiter->release();
+                if (EventWaiter::isLive(before)) {
+                    ++matched;
+                }
+                if (before & EventWaiter::suspendedBit) {
+                    *resumableTail = waiter;
+                    resumableTail = &waiter->nextWaiter;
+                }
+            };
+
+            if (0 != cancelCount(current))
+            {
+                /** New arrivals go behind the FIFO; cancelled awaiters are unlinked wherever they are **/
+                EventWaiter* arrived = reversed(newWaiters.exchange(nullptr, std::memory_order_acquire));
+                EventWaiter** link = &waiters;
+                while (taken < budget)
+                {
+                    if (!*link) {
+                        if (!arrived) {
+                            break;
+                        }
+                        *link = std::exchange(arrived, nullptr);
+                    }
+                    EventWaiter* const waiter = *link;
+                    if (EventWaiter::isCancelled(waiter->status.load(std::memory_order_acquire))) {
+                        *link = waiter->nextWaiter;
+                        take(waiter);
+                    } else {
+                        link = &waiter->nextWaiter;
+                    }
+                }
+                if (arrived) {
+                    while (*link) {
+                        link = &(*link)->nextWaiter;
+                    }
+                    *link = arrived;
+                }
+            }
+
+            /** A waiter cancelled meanwhile does not take the set(): the next one does **/
+            while (matched < setCount(current) && taken < budget)
+            {
+                if (!waiters) {
+                    waiters = reversed(newWaiters.exchange(nullptr, std::memory_order_acquire));
+                }
+                EventWaiter* const waiter = waiters;
+                waiters = waiter->nextWaiter;
+                take(waiter);
+            }
+
+            /** Taken waiters and matched sets go, requests seen are served; new ones keep this loop going **/
+            const uint64_t served = cancelCount(current);
+            if (taken == matched && 0 == served)
+            {
+                const uint64_t delta = matched * setIncrement + matched * waiterIncrement;
+                current = state.fetch_sub(delta, std::memory_order_acq_rel) - delta;
+                continue;
+            }
+
+            /** Unlinked cancelled waiters took no set(): what they leave must not accumulate **/
+            uint64_t old = state.load(std::memory_order_relaxed);
+            uint64_t next;
+            do {
+                const uint64_t waitersLeft = waiterCount(old) - taken;
+                const uint64_t setsLeft = std::min<uint64_t>(setCount(old) - matched, waitersLeft + 1);
+                next = setsLeft * setIncrement + waitersLeft * waiterIncrement + (cancelCount(old) - served) * cancelIncrement;
+            } while (!state.compare_exchange_weak(old, next, std::memory_order_acq_rel, std::memory_order_acquire));
+            current = next;
+        } while (hasWork(current));
+
+        *resumableTail = nullptr;
+        EventWaiter::resumeAll(resumable, workers);
+    }
+}
@@ -0,0 +1,293 @@
+/**============================================================================
+Name        : AsyncEvent.h
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Manual-reset and auto-reset events: any number of coroutines co_await them, waits are cancellable
+============================================================================**/
+
+#ifndef CPPCOROUTINES_ASYNCEVENT_H
+#define CPPCOROUTINES_ASYNCEVENT_H
+
+#include <atomic>
+#include <coroutine>
+#include <cstdint>
+
+#include "runtime/ThreadPool.h"
+
+namespace StdCoroutines::Runtime
+{
+    /**
+     * Common awaiter part: the intrusive link, the wait's status and how the waiter is resumed.
+     * 'status' is the phase plus two handshake bits: 'suspended' (await_suspend() is done with the
+     * awaiter) and 'released' (whoever unlinked it is done). The second of the two resumes the
+     * coroutine, so await_suspend() may still look at the awaiter after linking it in.
+    **/
+    struct EventWaiter : WorkItem
+    {
+        static constexpr uint8_t idle { 0 };
+        static constexpr uint8_t waiting { 1 };
+        static constexpr uint8_t signalled { 2 };
+        static constexpr uint8_t cancelled { 3 };
+        /** cancel() before the waiter was waiting: await_suspend() has it unlinked **/
+        static constexpr uint8_t cancelledEarly { 4 };
+        static constexpr uint8_t phaseMask { 7 };
+        static constexpr uint8_t suspendedBit { 8 };
+        static constexpr uint8_t releasedBit { 16 };
+
+        std::coroutine_handle<> continuation {};
+        EventWaiter* nextWaiter { nullptr };
+        std::atomic<uint8_t> status { idle };
+
+        EventWaiter() noexcept : WorkItem { nullptr, &resume } {
+        }
+
+        /** Only before it is awaited (e.g. wrapped by Trace::traced()) **/
+        EventWaiter(EventWaiter&& other) noexcept :
+                WorkItem { nullptr, &resume }, status { other.status.load(std::memory_order_relaxed) } {
+        }
+
+        [[nodiscard]]
+        static bool isLive(const uint8_t status) noexcept {
+            return (status & phaseMask) <= waiting;
+        }
+
+        [[nodiscard]]
+        static bool isCancelled(const uint8_t status) noexcept {
+            return (status & phaseMask) >= cancelled;
+        }
+
+        /** After resumption: the wait was ended by cancel(), the event was not signalled for it **/
+        [[nodiscard]]
+        bool interrupted() const noexcept {
+            return isCancelled(status.load(std::memory_order_acquire));
+        }
+
+        static void resume(WorkItem* item) {
+            static_cast<EventWaiter*>(item)->continuation.resume();
+        }
+
+        /** Completed without suspending: a cancel() coming later changes nothing **/
+        void markSignalled() noexcept {
+            status.store(signalled, std::memory_order_relaxed);
+        }
+
+        /** true - the event has to unlink the now cancelled waiter **/
+        [[nodiscard]]
+        bool markCancelled() noexcept;
+
+        /** By whoever unlinked the waiter; a live one becomes signalled. Returns the status before **/
+        uint8_t release() noexcept;
+
+        /** The last step of await_suspend(), once linked in. false - released already, don't suspend **/
+        template<typename Purge>
+        [[nodiscard]]
+        bool arrive(Purge&& purge) noexcept
+        {
+            uint8_t expected { idle };
+            if (status.compare_exchange_strong(expected, waiting | suspendedBit,
+                                               std::memory_order_acq_rel, std::memory_order_acquire)) {
+                return true;
+            }
+            if (expected & releasedBit) {
+                return false;
+            }
+            /** Cancelled while it was being linked in: nobody else knows it has to be unlinked **/
+            purge();
+            return 0 == (status.fetch_or(suspendedBit, std::memory_order_acq_rel) & releasedBit);
+        }
+
+        /** Released and suspended waiters: inline on the calling thread without a pool, posted to it otherwise **/
+        static void resumeAll(EventWaiter* waiters, ThreadPool* pool);
+
+        /** release() of every waiter in the chain, resuming those already suspended **/
+        static void releaseAll(EventWaiter* waiters, ThreadPool* pool);
+    };
+
+    /**
+     * Stays set until reset(). 'state' is either 'set' or the head of a lock-free stack of
+     * waiting awaiters: co_await is one CAS to link in and one to mark the awaiter waiting, and
+     * set() is one exchange followed by a walk of the detached stack - a broadcast to N waiters
+     * costs N resumptions and nothing else. Without a pool the waiters run inside set(), one
+     * after the other. Awaiter::cancel() marks the awaiter and asks for a purge: one thread at a
+     * time detaches the stack, resumes the cancelled awaiters and pushes the others back, so
+     * no frame is left behind by with_timeout(). No locks anywhere.
+    **/
+    class AsyncManualResetEvent
+    {
+    public:
+
+        struct Awaiter : EventWaiter
+        {
+            AsyncManualResetEvent& event;
+
+            explicit Awaiter(AsyncManualResetEvent& event) noexcept : event { event } {
+            }
+
+            [[nodiscard]]
+            bool await_ready() noexcept
+            {
+                /** TRUE ==> await_resume() or in case FALSE ==> await_suspend() will be called **/
+                if (event.is_set()) {
+                    markSignalled();
+                    return true;
+                }
+                return false;
+            }
+
+            bool await_suspend(std::coroutine_handle<> hInputCoro) noexcept;
+
+            void await_resume() const noexcept {
+            }
+
+            /** Resumes the waiter soon if it is still waiting; a later await_suspend() does not wait at all.
+             *  A waiter already released by set() keeps its signal **/
+            void cancel() noexcept;
+        };
+
+    private:
+
+        static constexpr uintptr_t notSetNoWaiters { 0 };
+        static constexpr uintptr_t isSet { 1 };
+
+        std::atomic<uintptr_t> state;
+        /** Purges asked for; whoever raises it from zero purges until no more are asked for **/
+        std::atomic<uint32_t> purgeRequests { 0 };
+        ThreadPool* pool { nullptr };
+
+        void purgeCancelled() noexcept;
+
+    public:
+
+        explicit AsyncManualResetEvent(const bool initiallySet = false, ThreadPool* pool = nullptr) noexcept :
+                state { initiallySet ? isSet : notSetNoWaiters }, pool { pool } {
+        }
+
+        AsyncManualResetEvent(const AsyncManualResetEvent&) = delete;
+        AsyncManualResetEvent& operator=(const AsyncManualResetEvent&) = delete;
+
+        [[nodiscard]]
+        bool is_set() const noexcept {
+            return isSet == state.load(std::memory_order_acquire);
+        }
+
+        /** Resumes every current waiter; later co_awaits complete immediately until reset() **/
+        void set() noexcept;
+
+        /** No effect on coroutines already waiting **/
+        void reset() noexcept;
+
+        Awaiter operator co_await() noexcept {
+            return Awaiter { *this };
+        }
+    };
+
+    /**
+     * Each set() lets exactly one coroutine through: a waiting one, or the next to arrive.
+     * 'state' packs the pending set() calls, the counted waiters and the cancellations asked
+     * for; awaiters link themselves into a lock-free stack of new arrivals. Whoever turns
+     * 'state' from "nothing to do" into "a set and a waiter, or a cancellation" becomes the
+     * single resumer: it drains the new arrivals into a FIFO only it touches, unlinks the
+     * cancelled awaiters and hands out matches until none are left. A cancelled awaiter met
+     * while matching does not take the set(): it goes on to the next one. No locks anywhere.
+    **/
+    class AsyncAutoResetEvent
+    {
+    public:
+
+        struct Awaiter : EventWaiter
+        {
+            AsyncAutoResetEvent& event;
+
+            explicit Awaiter(AsyncAutoResetEvent& event) noexcept : event { event } {
+            }
+
+            [[nodiscard]]
+            bool await_ready() noexcept
+            {
+                /** TRUE ==> await_resume() or in case FALSE ==> await_suspend() will be called **/
+                if (event.tryConsume()) {
+                    markSignalled();
+                    return true;
+                }
+                return false;
+            }
+
+            bool await_suspend(std::coroutine_handle<> hInputCoro) noexcept;
+
+            void await_resume() const noexcept {
+            }
+
+            /** Resumes the waiter soon if it is still waiting; a later await_suspend() does not wait at all.
+             *  A waiter already released by set() keeps its signal **/
+            void cancel() noexcept;
+        };
+
+    private:
+
+        static constexpr uint32_t fieldBits { 21 };
+        static constexpr uint64_t fieldMask { (uint64_t { 1 } << fieldBits) - 1 };
+        static constexpr uint64_t setIncrement { 1 };
+        static constexpr uint64_t waiterIncrement { uint64_t { 1 } << fieldBits };
+        static constexpr uint64_t cancelIncrement { uint64_t { 1 } << (2 * fieldBits) };
+
+        [[nodiscard]]
+        static uint32_t setCount(const uint64_t state) noexcept {
+            return static_cast<uint32_t>(state & fieldMask);
+        }
+
+        [[nodiscard]]
+        static uint32_t waiterCount(const uint64_t state) noexcept {
+            return static_cast<uint32_t>((state >> fieldBits) & fieldMask);
+        }
+
+        [[nodiscard]]
+        static uint32_t cancelCount(const uint64_t state) noexcept {
+            return static_cast<uint32_t>((state >> (2 * fieldBits)) & fieldMask);
+        }
+
+        [[nodiscard]]
+        static bool hasWork(const uint64_t state) noexcept {
+            return (0 != setCount(state) && 0 != waiterCount(state)) || 0 != cancelCount(state);
+        }
+
+        std::atomic<uint64_t> state;
+        std::atomic<EventWaiter*> newWaiters { nullptr };
+
+        /** Oldest first. Owned by the current resumer only **/
+        EventWaiter* waiters { nullptr };
+
+        ThreadPool* pool { nullptr };
+
+        [[nodiscard]]
+        bool tryConsume() noexcept;
+
+        /** Called by whoever added 'increment' to 'state': the one making work out of none resumes **/
+        void onStateAdded(uint64_t old, uint64_t increment) noexcept;
+
+        void requestPurge() noexcept;
+
+        void resumeWaiters(uint64_t initialState) noexcept;
+
+    public:
+
+        explicit AsyncAutoResetEvent(const bool initiallySet = false, ThreadPool* pool = nullptr) noexcept :
+                state { initiallySet ? setIncrement : 0 }, pool { pool } {
+        }
+
+        AsyncAutoResetEvent(const AsyncAutoResetEvent&) = delete;
+        AsyncAutoResetEvent& operator=(const AsyncAutoResetEvent&) = delete;
+
+        /** Setting an already set event has no effect: sets don't accumulate beyond the waiters **/
+        void set() noexcept;
+
+        void reset() noexcept;
+
+        Awaiter operator co_await() noexcept {
+            return Awaiter { *this };
+        }
+    };
+}
+
+#endif //CPPCOROUTINES_ASYNCEVENT_H
@@ -0,0 +1,40 @@
+/**============================================================================
+Name        : AsyncLatch.cpp
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Coroutine latch: co_await latch.wait() until the counter reaches zero
+============================================================================**/
+
+#include "AsyncLatch.h"
+
+namespace StdCoroutines::Runtime
+{
+    bool AsyncLatch::WaitAwaiter::await_suspend(const std::coroutine_handle<> hInputCoro) noexcept
+    {
+        continuation = hInputCoro;
+        uintptr_t old = latch.waiters.load(std::memory_order_acquire);
+        do {
+            if (released == old) {
+                return false;
+            }
+            nextWaiter = reinterpret_cast<WaitAwaiter*>(old);
+        } while (!latch.waiters.compare_exchange_weak(old, reinterpret_cast<uintptr_t>(this),
+                                                      std::memory_order_acq_rel, std::memory_order_acquire));
+        return true;
+    }
+
+    void AsyncLatch::count_down(const int64_t count)
+    {
+        if (count != remaining.fetch_sub(count, std::memory_order_acq_rel)) {
+            return;
+        }
+        auto* waiter = reinterpret_cast<WaitAwaiter*>(waiters.exchange(released, std::memory_order_acq_rel));
+        while (waiter) {
+            WaitAwaiter* const next = waiter->nextWaiter;
+            pool.post(waiter);
+            waiter = next;
+        }
+    }
+}
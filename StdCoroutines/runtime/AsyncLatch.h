@@ -0,0 +1,98 @@
+/**============================================================================
+Name        : AsyncLatch.h
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Coroutine latch: co_await latch.wait() until the counter reaches zero
+============================================================================**/
+
+#ifndef CPPCOROUTINES_ASYNCLATCH_H
+#define CPPCOROUTINES_ASYNCLATCH_H
+
+#include <atomic>
+#include <coroutine>
+#include <cstdint>
+
+#include "runtime/ThreadPool.h"
+
+namespace StdCoroutines::Runtime
+{
+    /**
+     * Single use, like std::latch. Waiters push their awaiters on a lock-free stack; the
+     * count_down() that reaches zero swaps the stack for the 'released' marker and posts
+     * every waiter to the pool. Once released, wait() completes without suspending.
+    **/
+    class AsyncLatch
+    {
+    public:
+
+        struct WaitAwaiter : WorkItem
+        {
+            AsyncLatch& latch;
+            std::coroutine_handle<> continuation {};
+            WaitAwaiter* nextWaiter { nullptr };
+
+            explicit WaitAwaiter(AsyncLatch& latch) noexcept : WorkItem { nullptr, &resume }, latch { latch } {
+            }
+
+            [[nodiscard]]
+            bool await_ready() const noexcept {
+                /** TRUE ==> await_resume() or in case FALSE ==> await_suspend() will be called **/
+                return latch.try_wait();
+            }
+
+            bool await_suspend(std::coroutine_handle<> hInputCoro) noexcept;
+
+            void await_resume() const noexcept {
+            }
+
+            static void resume(WorkItem* item) {
+                static_cast<WaitAwaiter*>(item)->continuation.resume();
+            }
+        };
+
+    private:
+
+        static constexpr uintptr_t released { 1 };
+
+        std::atomic<int64_t> remaining;
+
+        /** Head of the waiters' stack, or 'released' **/
+        std::atomic<uintptr_t> waiters { 0 };
+
+        ThreadPool& pool;
+
+    public:
+
+        explicit AsyncLatch(const int64_t expected, ThreadPool& pool = ThreadPool::shared()) noexcept :
+                remaining { expected }, waiters { 0 == expected ? released : 0 }, pool { pool } {
+        }
+
+        AsyncLatch(const AsyncLatch&) = delete;
+        AsyncLatch& operator=(const AsyncLatch&) = delete;
+
+        void count_down(int64_t count = 1);
+
+        [[nodiscard]]
+        bool try_wait() const noexcept {
+            return released == waiters.load(std::memory_order_acquire);
+        }
+
+        /** co_await latch.wait(); **/
+        [[nodiscard]]
+        WaitAwaiter wait() noexcept {
+            return WaitAwaiter { *this };
+        }
+
+        /** co_await latch.arrive_and_wait(); **/
+        [[nodiscard]]
+        WaitAwaiter arrive_and_wait(const int64_t count = 1)
+        {
+            count_down(count);
+            return WaitAwaiter { *this };
+        }
+    };
+}
+
+#endif //CPPCOROUTINES_ASYNCLATCH_H
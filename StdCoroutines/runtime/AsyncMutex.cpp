@@ -0,0 +1,64 @@
+/**============================================================================
+Name        : AsyncMutex.cpp
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Coroutine mutex: co_await mutex.lock() suspends instead of blocking
+============================================================================**/
+
+#include "AsyncMutex.h"
+
+namespace StdCoroutines::Runtime
+{
+    bool AsyncMutex::LockAwaiter::await_suspend(const std::coroutine_handle<> hInputCoro) noexcept
+    {
+        continuation = hInputCoro;
+        uintptr_t old = mutex.state.load(std::memory_order_acquire);
+        while (true)
+        {
+            if (notLocked == old)
+            {
+                /** Released in the meantime: take it and don't suspend **/
+                if (mutex.state.compare_exchange_weak(old, lockedNoWaiters,
+                                                      std::memory_order_acquire, std::memory_order_relaxed)) {
+                    return false;
+                }
+            }
+            else
+            {
+                nextWaiter = reinterpret_cast<LockAwaiter*>(old);
+                if (mutex.state.compare_exchange_weak(old, reinterpret_cast<uintptr_t>(this),
+                                                      std::memory_order_release, std::memory_order_relaxed)) {
+                    return true;
+                }
+            }
+        }
+    }
+
+    void AsyncMutex::unlock()
+    {
+        if (!waiters)
+        {
+            uintptr_t old { lockedNoWaiters };
+            if (state.compare_exchange_strong(old, notLocked, std::memory_order_release, std::memory_order_relaxed)) {
+                return;
+            }
+
+            /** New arrivals are stacked newest first: reverse them into FIFO order **/
+            old = state.exchange(lockedNoWaiters, std::memory_order_acquire);
+            auto* waiter = reinterpret_cast<LockAwaiter*>(old);
+            do {
+                LockAwaiter* const next = waiter->nextWaiter;
+                waiter->nextWaiter = waiters;
+                waiters = waiter;
+                waiter = next;
+            } while (waiter);
+        }
+
+        /** Ownership passes to the oldest waiter, the mutex stays locked **/
+        LockAwaiter* const next = waiters;
+        waiters = next->nextWaiter;
+        pool.post(next);
+    }
+}
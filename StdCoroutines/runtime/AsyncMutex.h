@@ -0,0 +1,141 @@
+/**============================================================================
+Name        : AsyncMutex.h
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Coroutine mutex: co_await mutex.lock() suspends instead of blocking
+============================================================================**/
+
+#ifndef CPPCOROUTINES_ASYNCMUTEX_H
+#define CPPCOROUTINES_ASYNCMUTEX_H
+
+#include <atomic>
+#include <coroutine>
+#include <cstdint>
+#include <utility>
+
+#include "runtime/ThreadPool.h"
+
+namespace StdCoroutines::Runtime
+{
+    class AsyncMutex;
+
+    /** Owns a locked AsyncMutex, unlocks it on destruction **/
+    class [[nodiscard]] AsyncLock
+    {
+        AsyncMutex* mutex { nullptr };
+
+    public:
+
+        explicit AsyncLock(AsyncMutex& mutex) noexcept : mutex { &mutex } {
+        }
+
+        AsyncLock(AsyncLock&& other) noexcept : mutex { std::exchange(other.mutex, nullptr) } {
+        }
+
+        AsyncLock(const AsyncLock&) = delete;
+        AsyncLock& operator=(const AsyncLock&) = delete;
+        AsyncLock& operator=(AsyncLock&&) = delete;
+
+        ~AsyncLock();
+    };
+
+    /**
+     * The uncontended lock()/unlock() is one CAS each. Waiters are the awaiters themselves,
+     * pushed on a lock-free stack in 'state' and moved to a FIFO owned by the lock holder.
+     * unlock() hands the mutex directly to the oldest waiter and resumes it on the pool,
+     * so long chains of waiters never nest resume() calls on one stack.
+    **/
+    class AsyncMutex
+    {
+    public:
+
+        struct LockAwaiter : WorkItem
+        {
+            AsyncMutex& mutex;
+            std::coroutine_handle<> continuation {};
+            LockAwaiter* nextWaiter { nullptr };
+
+            explicit LockAwaiter(AsyncMutex& mutex) noexcept : WorkItem { nullptr, &resume }, mutex { mutex } {
+            }
+
+            [[nodiscard]]
+            bool await_ready() const noexcept {
+                /** TRUE ==> await_resume() or in case FALSE ==> await_suspend() will be called **/
+                return mutex.try_lock();
+            }
+
+            bool await_suspend(std::coroutine_handle<> hInputCoro) noexcept;
+
+            void await_resume() const noexcept {
+            }
+
+            static void resume(WorkItem* item) {
+                static_cast<LockAwaiter*>(item)->continuation.resume();
+            }
+        };
+
+        struct ScopedLockAwaiter : LockAwaiter
+        {
+            using LockAwaiter::LockAwaiter;
+
+            [[nodiscard]]
+            AsyncLock await_resume() const noexcept {
+                return AsyncLock { mutex };
+            }
+        };
+
+    private:
+
+        static constexpr uintptr_t notLocked { 1 };
+        static constexpr uintptr_t lockedNoWaiters { 0 };
+
+        /** notLocked, lockedNoWaiters, or the head of a LIFO stack of newly arrived LockAwaiters **/
+        std::atomic<uintptr_t> state { notLocked };
+
+        /** FIFO of waiters, touched only by the current holder **/
+        LockAwaiter* waiters { nullptr };
+
+        ThreadPool& pool;
+
+    public:
+
+        explicit AsyncMutex(ThreadPool& pool = ThreadPool::shared()) noexcept : pool { pool } {
+        }
+
+        AsyncMutex(const AsyncMutex&) = delete;
+        AsyncMutex& operator=(const AsyncMutex&) = delete;
+
+        [[nodiscard]]
+        bool try_lock() noexcept
+        {
+            uintptr_t expected { notLocked };
+            return state.compare_exchange_strong(expected, lockedNoWaiters,
+                                                 std::memory_order_acquire, std::memory_order_relaxed);
+        }
+
+        /** co_await mutex.lock(); ... mutex.unlock(); **/
+        [[nodiscard]]
+        LockAwaiter lock() noexcept {
+            return LockAwaiter { *this };
+        }
+
+        /** const AsyncLock guard = co_await mutex.scoped_lock(); **/
+        [[nodiscard]]
+        ScopedLockAwaiter scoped_lock() noexcept {
+            return ScopedLockAwaiter { *this };
+        }
+
+        void unlock();
+    };
+
+    inline AsyncLock::~AsyncLock()
+    {
+        if (mutex) {
+            mutex->unlock();
+        }
+    }
+}
+
+#endif //CPPCOROUTINES_ASYNCMUTEX_H
@@ -0,0 +1,53 @@
+/**============================================================================
+Name        : AsyncSemaphore.cpp
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Coroutine counting semaphore: co_await semaphore.acquire() suspends instead of blocking
+============================================================================**/
+
+#include "AsyncSemaphore.h"
+
+namespace StdCoroutines::Runtime
+{
+    bool AsyncSemaphore::AcquireAwaiter::await_suspend(const std::coroutine_handle<> hInputCoro)
+    {
+        continuation = hInputCoro;
+        std::lock_guard lock { semaphore.mutex };
+
+        /** A release() that saw this waiter counted got here first and left its permit behind **/
+        if (semaphore.grants > 0) {
+            --semaphore.grants;
+            return false;
+        }
+        if (semaphore.waitersTail)
+            semaphore.waitersTail->nextWaiter = this;
+        else
+            semaphore.waitersHead = this;
+        semaphore.waitersTail = this;
+        return true;
+    }
+
+    void AsyncSemaphore::release(const int64_t count)
+    {
+        const int64_t old = counter.fetch_add(count, std::memory_order_release);
+        if (old >= 0) {
+            return;
+        }
+
+        /** Every permit up to the number of counted waiters goes to a waiter, not back to the pool **/
+        int64_t handOff = std::min(count, -old);
+        std::lock_guard lock { mutex };
+        for (; handOff > 0 && waitersHead; --handOff)
+        {
+            AcquireAwaiter* const waiter = waitersHead;
+            waitersHead = waiter->nextWaiter;
+            if (!waitersHead) {
+                waitersTail = nullptr;
+            }
+            pool.post(waiter);
+        }
+        grants += handOff;
+    }
+}
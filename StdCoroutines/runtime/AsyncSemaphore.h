@@ -0,0 +1,156 @@
+/**============================================================================
+Name        : AsyncSemaphore.h
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Coroutine counting semaphore: co_await semaphore.acquire() suspends instead of blocking
+============================================================================**/
+
+#ifndef CPPCOROUTINES_ASYNCSEMAPHORE_H
+#define CPPCOROUTINES_ASYNCSEMAPHORE_H
+
+#include <algorithm>
+#include <atomic>
+#include <coroutine>
+#include <cstdint>
+#include <mutex>
+#include <utility>
+
+#include "runtime/ThreadPool.h"
+
+namespace StdCoroutines::Runtime
+{
+    class AsyncSemaphore;
+
+    /** Owns one permit of an AsyncSemaphore, releases it on destruction **/
+    class [[nodiscard]] SemaphorePermit
+    {
+        AsyncSemaphore* semaphore { nullptr };
+
+    public:
+
+        explicit SemaphorePermit(AsyncSemaphore& semaphore) noexcept : semaphore { &semaphore } {
+        }
+
+        SemaphorePermit(SemaphorePermit&& other) noexcept : semaphore { std::exchange(other.semaphore, nullptr) } {
+        }
+
+        SemaphorePermit(const SemaphorePermit&) = delete;
+        SemaphorePermit& operator=(const SemaphorePermit&) = delete;
+        SemaphorePermit& operator=(SemaphorePermit&&) = delete;
+
+        ~SemaphorePermit();
+    };
+
+    /**
+     * 'counter' holds the free permits, or minus the number of waiters once it drops below zero:
+     * acquire() and release() are a single fetch_sub / fetch_add while permits are available.
+     * Only a coroutine that has to wait takes the slow path lock and links its awaiter into
+     * the FIFO; release() hands the permit straight to the oldest waiter and resumes it on
+     * the pool. Meant for bounding concurrency (e.g. requests in flight during a fan-out)
+     * without parking executor threads.
+    **/
+    class AsyncSemaphore
+    {
+    public:
+
+        struct AcquireAwaiter : WorkItem
+        {
+            AsyncSemaphore& semaphore;
+            std::coroutine_handle<> continuation {};
+            AcquireAwaiter* nextWaiter { nullptr };
+
+            explicit AcquireAwaiter(AsyncSemaphore& semaphore) noexcept : WorkItem { nullptr, &resume }, semaphore { semaphore } {
+            }
+
+            [[nodiscard]]
+            bool await_ready() const noexcept {
+                /** TRUE ==> await_resume() or in case FALSE ==> await_suspend() will be called **/
+                /** FALSE leaves this awaiter counted as a waiter: await_suspend() must run **/
+                return semaphore.counter.fetch_sub(1, std::memory_order_acquire) > 0;
+            }
+
+            bool await_suspend(std::coroutine_handle<> hInputCoro);
+
+            void await_resume() const noexcept {
+            }
+
+            static void resume(WorkItem* item) {
+                static_cast<AcquireAwaiter*>(item)->continuation.resume();
+            }
+        };
+
+        struct ScopedAcquireAwaiter : AcquireAwaiter
+        {
+            using AcquireAwaiter::AcquireAwaiter;
+
+            [[nodiscard]]
+            SemaphorePermit await_resume() const noexcept {
+                return SemaphorePermit { semaphore };
+            }
+        };
+
+    private:
+
+        std::atomic<int64_t> counter;
+
+        /** Slow path: waiters in arrival order. 'grants' - permits released to waiters not linked in yet **/
+        std::mutex mutex;
+        AcquireAwaiter* waitersHead { nullptr };
+        AcquireAwaiter* waitersTail { nullptr };
+        int64_t grants { 0 };
+
+        ThreadPool& pool;
+
+    public:
+
+        explicit AsyncSemaphore(const int64_t permits, ThreadPool& pool = ThreadPool::shared()) noexcept :
+                counter { permits }, pool { pool } {
+        }
+
+        AsyncSemaphore(const AsyncSemaphore&) = delete;
+        AsyncSemaphore& operator=(const AsyncSemaphore&) = delete;
+
+        [[nodiscard]]
+        bool try_acquire() noexcept
+        {
+            int64_t available = counter.load(std::memory_order_relaxed);
+            while (available > 0) {
+                if (counter.compare_exchange_weak(available, available - 1,
+                                                  std::memory_order_acquire, std::memory_order_relaxed)) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        /** co_await semaphore.acquire(); ... semaphore.release(); **/
+        [[nodiscard]]
+        AcquireAwaiter acquire() noexcept {
+            return AcquireAwaiter { *this };
+        }
+
+        /** const SemaphorePermit permit = co_await semaphore.scoped_acquire(); **/
+        [[nodiscard]]
+        ScopedAcquireAwaiter scoped_acquire() noexcept {
+            return ScopedAcquireAwaiter { *this };
+        }
+
+        void release(int64_t count = 1);
+
+        [[nodiscard]]
+        int64_t available() const noexcept {
+            return std::max<int64_t>(0, counter.load(std::memory_order_relaxed));
+        }
+    };
+
+    inline SemaphorePermit::~SemaphorePermit()
+    {
+        if (semaphore) {
+            semaphore->release();
+        }
+    }
+}
+
+#endif //CPPCOROUTINES_ASYNCSEMAPHORE_H
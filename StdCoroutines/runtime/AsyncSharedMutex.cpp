@@ -0,0 +1,172 @@
+/**============================================================================
+Name        : AsyncSharedMutex.cpp
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Coroutine reader-writer lock: co_await lock_shared() / co_await lock()
+============================================================================**/
+
+#include "AsyncSharedMutex.h"
+
+namespace StdCoroutines::Runtime
+{
+    size_t AsyncSharedMutex::readerSlot() noexcept
+    {
+        static std::atomic<size_t> nextSlot { 0 };
+        thread_local const size_t slot = nextSlot.fetch_add(1, std::memory_order_relaxed) % slotsCount;
+        return slot;
+    }
+
+    int64_t AsyncSharedMutex::readers() const noexcept
+    {
+        int64_t total { 0 };
+        for (const Slot& slot: slots) {
+            total += slot.readers.load(std::memory_order_seq_cst);
+        }
+        return total;
+    }
+
+    bool AsyncSharedMutex::tryLockShared(const size_t slot) noexcept
+    {
+        std::atomic<int64_t>& counter = slots[slot].readers;
+        counter.fetch_add(1, std::memory_order_seq_cst);
+        if (Free == state.load(std::memory_order_seq_cst)) {
+            return true;
+        }
+
+        /** A writer got there first. If it is waiting for this very count, await_suspend() lets it in **/
+        counter.fetch_sub(1, std::memory_order_seq_cst);
+        return false;
+    }
+
+    void AsyncSharedMutex::enqueue(Waiter* waiter) noexcept
+    {
+        waiter->nextWaiter = nullptr;
+        if (waitersTail)
+            waitersTail->nextWaiter = waiter;
+        else
+            waitersHead = waiter;
+        waitersTail = waiter;
+    }
+
+    void AsyncSharedMutex::grantIfDrained()
+    {
+        const bool writerWaits = drainingWriter || ReadersBeforeWriter == state.load(std::memory_order_relaxed);
+        if (!writerWaits || 0 != readers()) {
+            return;
+        }
+        if (drainingWriter) {
+            pool.post(std::exchange(drainingWriter, nullptr));
+        }
+        else if (ReadersBeforeWriter == state.load(std::memory_order_relaxed))
+        {
+            /** The admitted batch is done: the writer queued behind it is next **/
+            Waiter* const writer = waitersHead;
+            waitersHead = writer->nextWaiter;
+            if (!waitersHead) {
+                waitersTail = nullptr;
+            }
+            state.store(Writer, std::memory_order_seq_cst);
+            pool.post(writer);
+        }
+    }
+
+    bool AsyncSharedMutex::SharedAwaiter::await_suspend(const std::coroutine_handle<> hInputCoro)
+    {
+        continuation = hInputCoro;
+        std::lock_guard lock { mutex.mutex };
+
+        /** Leaving 'Free' needs no lock, but every way back to 'Free' takes it: 'state' is stable from here on **/
+        if (Free == mutex.state.load(std::memory_order_seq_cst))
+        {
+            std::atomic<int64_t>& counter = mutex.slots[slot].readers;
+            counter.fetch_add(1, std::memory_order_seq_cst);
+            if (Free == mutex.state.load(std::memory_order_seq_cst)) {
+                return false;
+            }
+            counter.fetch_sub(1, std::memory_order_seq_cst);
+        }
+        mutex.grantIfDrained();
+        mutex.enqueue(this);
+        return true;
+    }
+
+    bool AsyncSharedMutex::ExclusiveAwaiter::await_suspend(const std::coroutine_handle<> hInputCoro)
+    {
+        continuation = hInputCoro;
+        std::lock_guard lock { mutex.mutex };
+        if (!published)
+        {
+            uint32_t expected { Free };
+            if (!mutex.state.compare_exchange_strong(expected, Writer, std::memory_order_seq_cst)) {
+                mutex.enqueue(this);
+                return true;
+            }
+            published = true;
+        }
+
+        /** Readers that were counted before 'Writer' became visible still have to leave **/
+        if (0 == mutex.readers()) {
+            return false;
+        }
+        mutex.drainingWriter = this;
+        return true;
+    }
+
+    void AsyncSharedMutex::unlockShared(const size_t slot)
+    {
+        slots[slot].readers.fetch_sub(1, std::memory_order_seq_cst);
+        if (Free != state.load(std::memory_order_seq_cst))
+        {
+            std::lock_guard lock { mutex };
+            grantIfDrained();
+        }
+    }
+
+    void AsyncSharedMutex::unlock()
+    {
+        std::lock_guard lock { mutex };
+        if (!waitersHead) {
+            state.store(Free, std::memory_order_seq_cst);
+            return;
+        }
+
+        if (waitersHead->exclusive)
+        {
+            /** Writer to writer: 'state' stays 'Writer', only stray reader counts may have to drain **/
+            Waiter* const writer = waitersHead;
+            waitersHead = writer->nextWaiter;
+            if (!waitersHead) {
+                waitersTail = nullptr;
+            }
+            drainingWriter = writer;
+            grantIfDrained();
+            return;
+        }
+
+        /** The whole run of readers at the head goes at once, counted in the hand-off slot **/
+        Waiter* batch = nullptr;
+        Waiter** batchTail = &batch;
+        while (waitersHead && !waitersHead->exclusive)
+        {
+            Waiter* const reader = waitersHead;
+            waitersHead = reader->nextWaiter;
+            reader->slot = handoffSlot;
+            reader->nextWaiter = nullptr;
+            slots[handoffSlot].readers.fetch_add(1, std::memory_order_seq_cst);
+            *batchTail = reader;
+            batchTail = &reader->nextWaiter;
+        }
+        if (!waitersHead) {
+            waitersTail = nullptr;
+        }
+        state.store(waitersHead ? ReadersBeforeWriter : Free, std::memory_order_seq_cst);
+
+        while (batch) {
+            Waiter* const next = batch->nextWaiter;
+            pool.post(batch);
+            batch = next;
+        }
+    }
+}
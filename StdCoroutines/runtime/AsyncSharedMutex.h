@@ -0,0 +1,246 @@
+/**============================================================================
+Name        : AsyncSharedMutex.h
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Coroutine reader-writer lock: co_await lock_shared() / co_await lock()
+============================================================================**/
+
+#ifndef CPPCOROUTINES_ASYNCSHAREDMUTEX_H
+#define CPPCOROUTINES_ASYNCSHAREDMUTEX_H
+
+#include <array>
+#include <atomic>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <utility>
+
+#include "runtime/ThreadPool.h"
+
+namespace StdCoroutines::Runtime
+{
+    class AsyncSharedMutex;
+
+    /** Owns one shared hold on an AsyncSharedMutex: remembers the reader slot it counted in **/
+    class [[nodiscard]] SharedLock
+    {
+        AsyncSharedMutex* mutex { nullptr };
+        size_t slot { 0 };
+
+    public:
+
+        SharedLock(AsyncSharedMutex& mutex, const size_t slot) noexcept : mutex { &mutex }, slot { slot } {
+        }
+
+        SharedLock(SharedLock&& other) noexcept : mutex { std::exchange(other.mutex, nullptr) }, slot { other.slot } {
+        }
+
+        SharedLock(const SharedLock&) = delete;
+        SharedLock& operator=(const SharedLock&) = delete;
+        SharedLock& operator=(SharedLock&&) = delete;
+
+        ~SharedLock();
+    };
+
+    /** Owns the exclusive hold on an AsyncSharedMutex **/
+    class [[nodiscard]] UniqueLock
+    {
+        AsyncSharedMutex* mutex { nullptr };
+
+    public:
+
+        explicit UniqueLock(AsyncSharedMutex& mutex) noexcept : mutex { &mutex } {
+        }
+
+        UniqueLock(UniqueLock&& other) noexcept : mutex { std::exchange(other.mutex, nullptr) } {
+        }
+
+        UniqueLock(const UniqueLock&) = delete;
+        UniqueLock& operator=(const UniqueLock&) = delete;
+        UniqueLock& operator=(UniqueLock&&) = delete;
+
+        ~UniqueLock();
+    };
+
+    /**
+     * Readers count themselves in a per-thread, cache line sized slot and then check 'state':
+     * the uncontended lock_shared() / unlock writes no cache line shared with other threads.
+     * A writer publishes itself in 'state' first and then waits for every slot to drain
+     * (the Dekker pairing of the two seq_cst sequences makes one side see the other).
+     *
+     * Writer preference: once a writer is waiting, new readers queue behind it. Waiters are
+     * served in FIFO order; unlock() resumes the whole run of readers at the head of the
+     * queue at once, up to the next writer. Resumed coroutines continue on the pool.
+     * A shared hold must be released through the SharedLock it was granted with (the slot
+     * it counted in is recorded there), so lock_shared() hands out the guard directly.
+    **/
+    class AsyncSharedMutex
+    {
+    public:
+
+        struct Waiter : WorkItem
+        {
+            AsyncSharedMutex& mutex;
+            std::coroutine_handle<> continuation {};
+            Waiter* nextWaiter { nullptr };
+            size_t slot { 0 };
+            bool exclusive { false };
+
+            Waiter(AsyncSharedMutex& mutex, const bool exclusive) noexcept :
+                    WorkItem { nullptr, &resume }, mutex { mutex }, exclusive { exclusive } {
+            }
+
+            static void resume(WorkItem* item) {
+                static_cast<Waiter*>(item)->continuation.resume();
+            }
+        };
+
+        struct SharedAwaiter : Waiter
+        {
+            explicit SharedAwaiter(AsyncSharedMutex& mutex) noexcept : Waiter { mutex, false } {
+            }
+
+            [[nodiscard]]
+            bool await_ready() noexcept {
+                /** TRUE ==> await_resume() or in case FALSE ==> await_suspend() will be called **/
+                slot = readerSlot();
+                return mutex.tryLockShared(slot);
+            }
+
+            bool await_suspend(std::coroutine_handle<> hInputCoro);
+
+            [[nodiscard]]
+            SharedLock await_resume() const noexcept {
+                return SharedLock { mutex, slot };
+            }
+        };
+
+        struct ExclusiveAwaiter : Waiter
+        {
+            /** state was switched to 'Writer' in await_ready(), only the readers have to drain **/
+            bool published { false };
+
+            explicit ExclusiveAwaiter(AsyncSharedMutex& mutex) noexcept : Waiter { mutex, true } {
+            }
+
+            [[nodiscard]]
+            bool await_ready() noexcept
+            {
+                uint32_t expected { Free };
+                published = mutex.state.compare_exchange_strong(expected, Writer, std::memory_order_seq_cst);
+                return published && 0 == mutex.readers();
+            }
+
+            bool await_suspend(std::coroutine_handle<> hInputCoro);
+
+            void await_resume() const noexcept {
+            }
+        };
+
+        struct ScopedExclusiveAwaiter : ExclusiveAwaiter
+        {
+            using ExclusiveAwaiter::ExclusiveAwaiter;
+
+            [[nodiscard]]
+            UniqueLock await_resume() const noexcept {
+                return UniqueLock { mutex };
+            }
+        };
+
+    private:
+
+        static constexpr size_t cacheLineSize { 64 };
+        static constexpr size_t slotsCount { 64 };
+
+        /** Counter for readers admitted by unlock(): they are resumed on whatever thread the pool picks **/
+        static constexpr size_t handoffSlot { slotsCount };
+
+        enum State : uint32_t
+        {
+            Free,
+            Writer,              // a writer holds the lock or waits for the readers to drain
+            ReadersBeforeWriter  // a batch of admitted readers runs, a writer is next in the queue
+        };
+
+        struct alignas(cacheLineSize) Slot
+        {
+            std::atomic<int64_t> readers { 0 };
+        };
+
+        alignas(cacheLineSize) std::atomic<uint32_t> state { Free };
+        std::array<Slot, slotsCount + 1> slots {};
+
+        /** Slow path: the waiters' FIFO and the writer waiting for the readers to drain **/
+        alignas(cacheLineSize) std::mutex mutex;
+        Waiter* waitersHead { nullptr };
+        Waiter* waitersTail { nullptr };
+        Waiter* drainingWriter { nullptr };
+
+        ThreadPool& pool;
+
+        [[nodiscard]]
+        static size_t readerSlot() noexcept;
+
+        [[nodiscard]]
+        bool tryLockShared(size_t slot) noexcept;
+
+        [[nodiscard]]
+        int64_t readers() const noexcept;
+
+        void enqueue(Waiter* waiter) noexcept;
+
+        /** With 'mutex' held: hands the lock to the draining / next writer once no reader is counted **/
+        void grantIfDrained();
+
+        void unlockShared(size_t slot);
+
+        friend class SharedLock;
+
+    public:
+
+        explicit AsyncSharedMutex(ThreadPool& pool = ThreadPool::shared()) noexcept : pool { pool } {
+        }
+
+        AsyncSharedMutex(const AsyncSharedMutex&) = delete;
+        AsyncSharedMutex& operator=(const AsyncSharedMutex&) = delete;
+
+        /** const SharedLock guard = co_await mutex.lock_shared(); **/
+        [[nodiscard]]
+        SharedAwaiter lock_shared() noexcept {
+            return SharedAwaiter { *this };
+        }
+
+        /** co_await mutex.lock(); ... mutex.unlock(); **/
+        [[nodiscard]]
+        ExclusiveAwaiter lock() noexcept {
+            return ExclusiveAwaiter { *this };
+        }
+
+        /** const UniqueLock guard = co_await mutex.scoped_lock(); **/
+        [[nodiscard]]
+        ScopedExclusiveAwaiter scoped_lock() noexcept {
+            return ScopedExclusiveAwaiter { *this };
+        }
+
+        void unlock();
+    };
+
+    inline SharedLock::~SharedLock()
+    {
+        if (mutex) {
+            mutex->unlockShared(slot);
+        }
+    }
+
+    inline UniqueLock::~UniqueLock()
+    {
+        if (mutex) {
+            mutex->unlock();
+        }
+    }
+}
+
+#endif //CPPCOROUTINES_ASYNCSHAREDMUTEX_H
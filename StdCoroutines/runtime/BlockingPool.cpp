@@ -0,0 +1,117 @@
+/**============================================================================
+Name        : BlockingPool.cpp
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Elastic pool for blocking calls + co_await offload_blocking(fn)
+============================================================================**/
+
+#include "BlockingPool.h"
+
+#include <algorithm>
+
+namespace StdCoroutines::Runtime
+{
+    BlockingPool::BlockingPool(const Options& options): options { options } {
+        this->options.maxThreads = std::max<size_t>(1, options.maxThreads);
+    }
+
+    BlockingPool::~BlockingPool()
+    {
+        {
+            std::lock_guard lock { mutex };
+            stopping = true;
+        }
+        available.notify_all();
+        threads.clear();
+    }
+
+    BlockingPool& BlockingPool::shared()
+    {
+        static BlockingPool pool;
+        return pool;
+    }
+
+    void BlockingPool::startThread()
+    {
+        for (const std::thread::id id: exited)
+        {
+            const auto iter = std::ranges::find_if(threads, [id](const std::jthread& thread) {
+                return thread.get_id() == id;
+            });
+            iter->join();
+            threads.erase(iter);
+        }
+        exited.clear();
+
+        threads.emplace_back([this] { workerLoop(); });
+        ++statistics.threads;
+        ++statistics.started;
+        statistics.peakThreads = std::max(statistics.peakThreads, statistics.threads);
+    }
+
+    void BlockingPool::post(WorkItem* item)
+    {
+        item->next = nullptr;
+        bool wakeThread { false };
+        {
+            std::lock_guard lock { mutex };
+            if (tail) {
+                tail->next = item;
+            } else {
+                head = item;
+            }
+            tail = item;
+            ++queued;
+
+            /** Idle threads that were woken but have not taken an item yet are still counted idle:
+             *  compare with the queue, so a burst of posts gets a thread per item **/
+            wakeThread = statistics.idle > 0;
+            if (queued > statistics.idle && statistics.threads < options.maxThreads) {
+                startThread();
+            }
+        }
+        if (wakeThread) {
+            available.notify_one();
+        }
+    }
+
+    BlockingPool::Stats BlockingPool::stats()
+    {
+        std::lock_guard lock { mutex };
+        return statistics;
+    }
+
+    void BlockingPool::workerLoop()
+    {
+        while (true)
+        {
+            WorkItem* item { nullptr };
+            {
+                std::unique_lock lock { mutex };
+                while (!head && !stopping)
+                {
+                    ++statistics.idle;
+                    const bool timedOut = std::cv_status::timeout == available.wait_for(lock, options.keepAlive);
+                    --statistics.idle;
+                    if (timedOut && !head && !stopping) {
+                        --statistics.threads;
+                        exited.push_back(std::this_thread::get_id());
+                        return;
+                    }
+                }
+                if (!head) {
+                    return;
+                }
+                item = head;
+                head = item->next;
+                --queued;
+                if (!head) {
+                    tail = nullptr;
+                }
+            }
+            item->execute(item);
+        }
+    }
+}
@@ -0,0 +1,169 @@
+/**============================================================================
+Name        : BlockingPool.h
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Elastic pool for blocking calls + co_await offload_blocking(fn)
+============================================================================**/
+
+#ifndef CPPCOROUTINES_BLOCKINGPOOL_H
+#define CPPCOROUTINES_BLOCKINGPOOL_H
+
+#include <chrono>
+#include <condition_variable>
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "runtime/ThreadPool.h"
+
+namespace StdCoroutines::Runtime
+{
+    /**
+     * Threads for calls that block (file reads, sleeps, legacy client libraries): a parked call
+     * holds one of these, never a ThreadPool worker. A thread is started whenever an item
+     * arrives and none is idle, up to 'maxThreads'; a thread idle for 'keepAlive' exits.
+     * Items posted above the limit queue up.
+    **/
+    class BlockingPool
+    {
+    public:
+
+        struct Options
+        {
+            size_t maxThreads { 256 };
+            std::chrono::milliseconds keepAlive { 10'000 };
+        };
+
+        struct Stats
+        {
+            size_t threads { 0 };
+            size_t idle { 0 };
+            size_t peakThreads { 0 };
+            size_t started { 0 };
+        };
+
+    private:
+
+        std::mutex mutex;
+        std::condition_variable available;
+        WorkItem* head { nullptr };
+        WorkItem* tail { nullptr };
+        size_t queued { 0 };
+        Options options;
+        Stats statistics;
+        bool stopping { false };
+
+        std::vector<std::jthread> threads;
+
+        /** Threads that timed out: they no longer touch the pool, joined on the next start **/
+        std::vector<std::thread::id> exited;
+
+        void workerLoop();
+
+        /** With 'mutex' held **/
+        void startThread();
+
+    public:
+
+        explicit BlockingPool(const Options& options);
+        BlockingPool(): BlockingPool(Options {}) {}
+
+        /** Runs everything already posted, then joins the threads **/
+        ~BlockingPool();
+
+        BlockingPool(const BlockingPool&) = delete;
+        BlockingPool& operator=(const BlockingPool&) = delete;
+
+        static BlockingPool& shared();
+
+        /** No allocation: the item must stay alive until its execute() has been called **/
+        void post(WorkItem* item);
+
+        [[nodiscard]]
+        Stats stats();
+    };
+
+    /**
+     * co_await offload_blocking(fn): 'fn' runs on a blocking pool thread, the coroutine continues
+     * on 'pool' with its result (or exception). The awaiter is the work item for both hops.
+    **/
+    template<typename Function>
+    struct OffloadAwaiter : WorkItem
+    {
+        using Result = std::invoke_result_t<Function&>;
+
+        Function function;
+        BlockingPool& blocking;
+        ThreadPool& pool;
+        std::coroutine_handle<> continuation {};
+        std::conditional_t<std::is_void_v<Result>, bool, std::optional<Result>> result {};
+        std::exception_ptr error {};
+
+        OffloadAwaiter(Function function, BlockingPool& blocking, ThreadPool& pool) :
+                WorkItem { nullptr, &call }, function { std::move(function) }, blocking { blocking }, pool { pool } {
+        }
+
+        [[nodiscard]]
+        bool await_ready() const noexcept {
+            /** TRUE ==> await_resume() or in case FALSE ==> await_suspend() will be called **/
+            return false;
+        }
+
+        void await_suspend(const std::coroutine_handle<> hInputCoro)
+        {
+            continuation = hInputCoro;
+            blocking.post(this);
+        }
+
+        Result await_resume()
+        {
+            if (error) {
+                std::rethrow_exception(error);
+            }
+            if constexpr (!std::is_void_v<Result>) {
+                return std::move(*result);
+            }
+        }
+
+        /** On the blocking thread **/
+        static void call(WorkItem* item)
+        {
+            OffloadAwaiter* self = static_cast<OffloadAwaiter*>(item);
+            try {
+                if constexpr (std::is_void_v<Result>) {
+                    std::invoke(self->function);
+                } else {
+                    self->result.emplace(std::invoke(self->function));
+                }
+            } catch (...) {
+                self->error = std::current_exception();
+            }
+            self->execute = &resume;
+            self->pool.post(self);
+        }
+
+        static void resume(WorkItem* item) {
+            static_cast<OffloadAwaiter*>(item)->continuation.resume();
+        }
+    };
+
+    template<typename Function>
+    [[nodiscard]]
+    OffloadAwaiter<std::decay_t<Function>> offload_blocking(Function&& function,
+                                                            ThreadPool& pool = ThreadPool::shared(),
+                                                            BlockingPool& blocking = BlockingPool::shared())
+    {
+        return OffloadAwaiter<std::decay_t<Function>> { std::forward<Function>(function), blocking, pool };
+    }
+}
+
+#endif //CPPCOROUTINES_BLOCKINGPOOL_H
@@ -0,0 +1,96 @@
+/**============================================================================
+Name        : CallbackAwaiter.h
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : co_await adapter for C-style (void* userData, callback) APIs
+============================================================================**/
+
+#ifndef CPPCOROUTINES_CALLBACKAWAITER_H
+#define CPPCOROUTINES_CALLBACKAWAITER_H
+
+#include <coroutine>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "runtime/ThreadPool.h"
+
+namespace StdCoroutines::Runtime
+{
+    /**
+     * The awaiter itself is the 'userData' handed to the C API and the WorkItem handed to the pool,
+     * so the whole operation lives in the awaiting coroutine's frame: no allocation, no thread.
+     * Whatever thread the API calls back on, the coroutine continues on a pool worker.
+    **/
+    template<typename Start, typename... Args>
+    class CallbackAwaiter : WorkItem
+    {
+        Start start;
+        ThreadPool& pool;
+        std::coroutine_handle<> continuation {};
+        std::optional<std::tuple<std::decay_t<Args>...>> results;
+
+        static void complete(void* userData, Args... args)
+        {
+            auto* self = static_cast<CallbackAwaiter*>(userData);
+            self->results.emplace(std::forward<Args>(args)...);
+            self->pool.post(self);
+        }
+
+        static void resume(WorkItem* item) {
+            static_cast<CallbackAwaiter*>(item)->continuation.resume();
+        }
+
+    public:
+
+        using Callback = void (*)(void*, Args...);
+
+        CallbackAwaiter(Start start, ThreadPool& pool) : WorkItem { nullptr, &resume }, start { std::move(start) }, pool { pool } {
+        }
+
+        [[nodiscard]]
+        bool await_ready() const noexcept {
+            /** TRUE ==> await_resume() or in case FALSE ==> await_suspend() will be called **/
+            return false;
+        }
+
+        void await_suspend(const std::coroutine_handle<> hInputCoro)
+        {
+            continuation = hInputCoro;
+
+            /** The callback may run (and the frame may be gone) before start() returns: call a local copy **/
+            Start starter { std::move(start) };
+            starter(static_cast<void*>(this), static_cast<Callback>(&complete));
+        }
+
+        /** void, the single callback argument, or a tuple of them **/
+        auto await_resume()
+        {
+            if constexpr (0 == sizeof...(Args)) {
+                return;
+            } else if constexpr (1 == sizeof...(Args)) {
+                return std::get<0>(std::move(*results));
+            } else {
+                return std::move(*results);
+            }
+        }
+    };
+
+    /**
+     * Usage: auto [a, b] = co_await fromCallback<int, int>([](void* userData, auto callback) {
+     *            legacy_api(userData, callback);
+     *        });
+     * 'Args' are the callback arguments after 'userData'. 'start' is stored by value in the awaiter.
+    **/
+    template<typename... Args, typename Start>
+    [[nodiscard]]
+    CallbackAwaiter<std::decay_t<Start>, Args...> fromCallback(Start&& start, ThreadPool& pool = ThreadPool::shared())
+    {
+        return CallbackAwaiter<std::decay_t<Start>, Args...> { std::forward<Start>(start), pool };
+    }
+}
+
+#endif //CPPCOROUTINES_CALLBACKAWAITER_H
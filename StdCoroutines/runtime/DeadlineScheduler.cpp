@@ -0,0 +1,121 @@
+/**============================================================================
+Name        : DeadlineScheduler.cpp
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Earliest-deadline-first worker pool with deadline miss metrics
+============================================================================**/
+
+#include "DeadlineScheduler.h"
+
+#include <algorithm>
+
+namespace
+{
+    using StdCoroutines::Runtime::DeadlineItem;
+
+    /** std::*_heap keep the largest element on top: "larger" here means due later **/
+    bool dueLater(const DeadlineItem* left, const DeadlineItem* right) noexcept
+    {
+        if (left->deadline != right->deadline) {
+            return left->deadline > right->deadline;
+        }
+        return left->sequence > right->sequence;
+    }
+}
+
+namespace StdCoroutines::Runtime
+{
+    DeadlineScheduler::DeadlineScheduler(const Options& options)
+    {
+        const size_t count = std::max<size_t>(1, options.threads);
+        heap.reserve(1024);
+        workers.reserve(count);
+        for (size_t idx = 0; idx < count; ++idx) {
+            workers.emplace_back([this] { workerLoop(); });
+        }
+    }
+
+    DeadlineScheduler::~DeadlineScheduler()
+    {
+        {
+            std::lock_guard lock { mutex };
+            stopping = true;
+        }
+        available.notify_all();
+        workers.clear();
+    }
+
+    void DeadlineScheduler::post(DeadlineItem* item) noexcept
+    {
+        item->next = nullptr;
+        bool wakeWorker { false };
+        {
+            std::lock_guard lock { mutex };
+            item->sequence = sequence++;
+            heap.push_back(item);
+            std::ranges::push_heap(heap, dueLater);
+            wakeWorker = idleWorkers > 0;
+        }
+        if (wakeWorker) {
+            available.notify_one();
+        }
+    }
+
+    void DeadlineScheduler::recordCompletion(const DeadlineClock::time_point deadline) noexcept
+    {
+        completed.fetch_add(1, std::memory_order_relaxed);
+        const auto lateness = DeadlineClock::now() - deadline;
+        if (lateness > DeadlineClock::duration::zero())
+        {
+            missed.fetch_add(1, std::memory_order_relaxed);
+            const int64_t nanos = std::chrono::duration_cast<std::chrono::nanoseconds>(lateness).count();
+            int64_t current = maxLateness.load(std::memory_order_relaxed);
+            while (current < nanos && !maxLateness.compare_exchange_weak(current, nanos, std::memory_order_relaxed)) {
+            }
+        }
+    }
+
+    DeadlineScheduler::Stats DeadlineScheduler::stats()
+    {
+        Stats result;
+        {
+            std::lock_guard lock { mutex };
+            result.dispatched = dispatched;
+            result.lateDispatches = lateDispatches;
+        }
+        result.completed = completed.load(std::memory_order_relaxed);
+        result.missed = missed.load(std::memory_order_relaxed);
+        result.maxLateness = std::chrono::nanoseconds { maxLateness.load(std::memory_order_relaxed) };
+        return result;
+    }
+
+    void DeadlineScheduler::workerLoop()
+    {
+        while (true)
+        {
+            DeadlineItem* item { nullptr };
+            {
+                std::unique_lock lock { mutex };
+                while (heap.empty() && !stopping) {
+                    ++idleWorkers;
+                    available.wait(lock);
+                    --idleWorkers;
+                }
+                if (heap.empty()) {
+                    return;
+                }
+                std::ranges::pop_heap(heap, dueLater);
+                item = heap.back();
+                heap.pop_back();
+
+                ++dispatched;
+                if (item->deadline != DeadlineClock::time_point::max() && DeadlineClock::now() > item->deadline) {
+                    ++lateDispatches;
+                }
+            }
+            item->execute(item);
+        }
+    }
+}
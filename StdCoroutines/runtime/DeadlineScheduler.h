@@ -0,0 +1,212 @@
+/**============================================================================
+Name        : DeadlineScheduler.h
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Earliest-deadline-first worker pool with deadline miss metrics
+============================================================================**/
+
+#ifndef CPPCOROUTINES_DEADLINESCHEDULER_H
+#define CPPCOROUTINES_DEADLINESCHEDULER_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "runtime/Task.h"
+#include "runtime/ThreadPool.h"
+
+namespace StdCoroutines::Runtime
+{
+    using DeadlineClock = std::chrono::steady_clock;
+
+    /** WorkItem ordered by 'deadline'; 'sequence' keeps equal deadlines (and the deadline-less ones) FIFO **/
+    struct DeadlineItem : WorkItem
+    {
+        DeadlineClock::time_point deadline { DeadlineClock::time_point::max() };
+        uint64_t sequence { 0 };
+    };
+
+    /**
+     * EDF: all workers share one ready heap keyed by deadline, so the globally most urgent
+     * coroutine runs next - what soft real-time pipelines need, finishing on time over raw
+     * throughput. Work without a deadline runs only when nothing with one is ready.
+     *
+     * Misses are counted twice: at dispatch (already late when a worker took it, nothing could
+     * save it any more) and, for tasks started through submit(), at completion.
+    **/
+    class DeadlineScheduler
+    {
+    public:
+
+        struct Options
+        {
+            size_t threads { std::thread::hardware_concurrency() };
+        };
+
+        struct Stats
+        {
+            uint64_t dispatched { 0 };
+            uint64_t lateDispatches { 0 };
+            uint64_t completed { 0 };
+            uint64_t missed { 0 };
+            std::chrono::nanoseconds maxLateness { 0 };
+        };
+
+        /** co_await scheduler.schedule(): continue on a worker, ordered by the awaiting task's promise deadline **/
+        struct ScheduleAwaiter : DeadlineItem
+        {
+            DeadlineScheduler& scheduler;
+            std::optional<DeadlineClock::time_point> explicitDeadline {};
+            std::coroutine_handle<> continuation {};
+
+            ScheduleAwaiter(DeadlineScheduler& scheduler, const std::optional<DeadlineClock::time_point> deadline) noexcept :
+                    DeadlineItem { { nullptr, &resume } }, scheduler { scheduler }, explicitDeadline { deadline } {
+            }
+
+            [[nodiscard]]
+            bool await_ready() const noexcept {
+                /** TRUE ==> await_resume() or in case FALSE ==> await_suspend() will be called **/
+                return false;
+            }
+
+            template<typename Promise>
+            void await_suspend(const std::coroutine_handle<Promise> hInputCoro) noexcept
+            {
+                continuation = hInputCoro;
+                if (explicitDeadline) {
+                    deadline = *explicitDeadline;
+                } else if constexpr (requires { hInputCoro.promise().deadline; }) {
+                    deadline = hInputCoro.promise().deadline;
+                }
+                scheduler.post(this);
+            }
+
+            void await_resume() const noexcept {
+            }
+
+            static void resume(WorkItem* item) {
+                static_cast<ScheduleAwaiter*>(item)->continuation.resume();
+            }
+        };
+
+    private:
+
+        std::mutex mutex;
+        std::condition_variable available;
+        std::vector<DeadlineItem*> heap;
+        uint64_t sequence { 0 };
+        size_t idleWorkers { 0 };
+        bool stopping { false };
+
+        /** Updated by the workers only, under 'mutex' **/
+        uint64_t dispatched { 0 };
+        uint64_t lateDispatches { 0 };
+
+        std::atomic<uint64_t> completed { 0 };
+        std::atomic<uint64_t> missed { 0 };
+        std::atomic<int64_t> maxLateness { 0 };
+
+        std::vector<std::jthread> workers;
+
+        void workerLoop();
+
+        void recordCompletion(DeadlineClock::time_point deadline) noexcept;
+
+    public:
+
+        explicit DeadlineScheduler(const Options& options);
+        DeadlineScheduler(): DeadlineScheduler(Options {}) {}
+
+        /** Runs everything already posted, then joins the workers **/
+        ~DeadlineScheduler();
+
+        DeadlineScheduler(const DeadlineScheduler&) = delete;
+        DeadlineScheduler& operator=(const DeadlineScheduler&) = delete;
+
+        [[nodiscard]]
+        size_t size() const noexcept {
+            return workers.size();
+        }
+
+        /** No allocation: the item must stay alive until its execute() has been called **/
+        void post(DeadlineItem* item) noexcept;
+
+        /** At the awaiting task's promise deadline (none for other coroutine types) **/
+        [[nodiscard]]
+        ScheduleAwaiter schedule() noexcept {
+            return ScheduleAwaiter { *this, std::nullopt };
+        }
+
+        [[nodiscard]]
+        ScheduleAwaiter schedule(const DeadlineClock::time_point deadline) noexcept {
+            return ScheduleAwaiter { *this, deadline };
+        }
+
+    private:
+
+        /** Checks the completion against the deadline however the task ends, with a value or an exception **/
+        struct CompletionRecorder
+        {
+            DeadlineScheduler& scheduler;
+            DeadlineClock::time_point deadline;
+
+            ~CompletionRecorder() {
+                scheduler.recordCompletion(deadline);
+            }
+        };
+
+        template<typename T>
+        Task<T> runToDeadline(Task<T> task, const DeadlineClock::time_point deadline)
+        {
+            co_await schedule(deadline);
+            const CompletionRecorder recorder { *this, deadline };
+            co_return co_await std::move(task);
+        }
+
+    public:
+
+        /**
+         * spawn(scheduler.submit(job(), deadline)): 'task' gets the deadline in its promise (its own
+         * schedule() hops are ordered by it), starts on a worker and its completion, normal or by
+         * an exception, is checked against the deadline.
+        **/
+        template<typename T>
+        [[nodiscard]]
+        Task<T> submit(Task<T> task, const DeadlineClock::time_point deadline)
+        {
+            if (!task.handle()) {
+                throw std::logic_error("DeadlineScheduler: submit of an empty task");
+            }
+            task.handle().promise().deadline = deadline;
+            return runToDeadline(std::move(task), deadline);
+        }
+
+        [[nodiscard]]
+        Stats stats();
+    };
+
+    /** Sets the deadline a not yet started task is scheduled with **/
+    template<typename T>
+    [[nodiscard]]
+    Task<T> with_deadline(Task<T> task, const DeadlineClock::time_point deadline)
+    {
+        if (!task.handle()) {
+            throw std::logic_error("with_deadline: empty task");
+        }
+        task.handle().promise().deadline = deadline;
+        return task;
+    }
+}
+
+#endif //CPPCOROUTINES_DEADLINESCHEDULER_H
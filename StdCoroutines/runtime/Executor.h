@@ -0,0 +1,111 @@
+/**============================================================================
+Name        : Executor.h
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Executor affinity: co_await schedule_on(pool) / resume_on(awaitable, pool)
+============================================================================**/
+
+#ifndef CPPCOROUTINES_EXECUTOR_H
+#define CPPCOROUTINES_EXECUTOR_H
+
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#include "runtime/Task.h"
+#include "runtime/ThreadPool.h"
+
+namespace StdCoroutines::Runtime
+{
+    /** co_await schedule_on(pool): continue on 'pool'. No hop when already running on one of its workers **/
+    struct ScheduleOnAwaiter : ThreadPool::ScheduleAwaiter
+    {
+        using ScheduleAwaiter::ScheduleAwaiter;
+
+        [[nodiscard]]
+        bool await_ready() const noexcept {
+            /** TRUE ==> await_resume() or in case FALSE ==> await_suspend() will be called **/
+            return ThreadPool::current() == &pool;
+        }
+    };
+
+    [[nodiscard]]
+    inline ScheduleOnAwaiter schedule_on(ThreadPool& pool) noexcept {
+        return ScheduleOnAwaiter { pool };
+    }
+
+    namespace Details
+    {
+        /**
+         * 'Awaitable' is a reference for lvalues (the caller keeps them alive while it awaits) and
+         * a value moved into the frame for temporaries. Whoever completes 'awaitable' resumes this
+         * frame only for the hop: the caller continues on 'pool', with the result or the exception.
+        **/
+        template<typename Awaitable>
+        Task<AwaitResult<Awaitable>> resumeOn(Awaitable awaitable, ThreadPool* pool)
+        {
+            using Result = AwaitResult<Awaitable>;
+            std::exception_ptr error {};
+            if constexpr (std::is_void_v<Result>)
+            {
+                try {
+                    co_await static_cast<Awaitable&&>(awaitable);
+                } catch (...) {
+                    error = std::current_exception();
+                }
+                if (pool) {
+                    co_await schedule_on(*pool);
+                }
+                if (error) {
+                    std::rethrow_exception(error);
+                }
+            }
+            else
+            {
+                std::optional<Result> result {};
+                try {
+                    result.emplace(co_await static_cast<Awaitable&&>(awaitable));
+                } catch (...) {
+                    error = std::current_exception();
+                }
+                if (pool) {
+                    co_await schedule_on(*pool);
+                }
+                if (error) {
+                    std::rethrow_exception(error);
+                }
+                co_return std::move(*result);
+            }
+        }
+    }
+
+    /**
+     * co_await resume_on(awaitable, pool): awaits 'awaitable' and continues on 'pool', whichever
+     * thread completed it (a timer, an I/O loop, a detached helper thread). Costs one Task frame;
+     * the hop is skipped when the completing thread already belongs to 'pool'.
+    **/
+    template<typename Awaitable>
+    [[nodiscard]]
+    Task<Details::AwaitResult<Awaitable>> resume_on(Awaitable&& awaitable, ThreadPool& pool)
+    {
+        return Details::resumeOn<Awaitable>(std::forward<Awaitable>(awaitable), &pool);
+    }
+
+    /**
+     * The 'resume on the originating executor' policy: the pool of the thread evaluating the
+     * co_await is captured, cache hot continuations go back there instead of staying on the
+     * completing thread. Off any pool (e.g. under syncWait) it is a plain co_await.
+    **/
+    template<typename Awaitable>
+    [[nodiscard]]
+    Task<Details::AwaitResult<Awaitable>> resume_on_origin(Awaitable&& awaitable)
+    {
+        return Details::resumeOn<Awaitable>(std::forward<Awaitable>(awaitable), ThreadPool::current());
+    }
+}
+
+#endif //CPPCOROUTINES_EXECUTOR_H
@@ -0,0 +1,153 @@
+/**============================================================================
+Name        : FileAppender.cpp
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : co_await appender.append(bytes): group commit of appends to one file
+============================================================================**/
+
+#include "FileAppender.h"
+
+#include <cerrno>
+#include <system_error>
+#include <utility>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace StdCoroutines::Runtime
+{
+    FileAppender::FileAppender(const std::filesystem::path& path, const Options& options, ThreadPool& pool):
+            options { options }, pool { pool }
+    {
+        fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+        if (fd < 0) {
+            throw std::system_error(errno, std::system_category(), "FileAppender: open");
+        }
+        buffer.reserve(options.flushThreshold * 2);
+        writing.reserve(options.flushThreshold * 2);
+        flusher = std::jthread { [this] { flushLoop(); } };
+    }
+
+    FileAppender::~FileAppender()
+    {
+        {
+            std::lock_guard lock { mutex };
+            stopping = true;
+        }
+        wakeup.notify();
+        flusher.join();
+        ::close(fd);
+    }
+
+    FileAppender::Stats FileAppender::stats()
+    {
+        std::lock_guard lock { mutex };
+        return statistics;
+    }
+
+    void FileAppender::enqueue(AppendAwaiter* awaiter)
+    {
+        bool first { false }, full { false };
+        {
+            std::lock_guard lock { mutex };
+            first = buffer.empty();
+            buffer.insert(buffer.end(), awaiter->bytes.begin(), awaiter->bytes.end());
+            full = buffer.size() >= options.flushThreshold;
+
+            awaiter->nextWaiter = nullptr;
+            if (waitersTail)
+                waitersTail->nextWaiter = awaiter;
+            else
+                waitersHead = awaiter;
+            waitersTail = awaiter;
+        }
+
+        /** The flusher only needs to hear about the start of a batch and about a full buffer **/
+        if (first || full) {
+            wakeup.notify();
+        }
+    }
+
+    void FileAppender::flushLoop()
+    {
+        while (true)
+        {
+            wakeup.wait();
+
+            /** Group commit window: collect more appends until the interval expires or the buffer fills up **/
+            const auto deadline = std::chrono::steady_clock::now() + options.flushInterval;
+            while (true)
+            {
+                {
+                    std::lock_guard lock { mutex };
+                    if (stopping || buffer.size() >= options.flushThreshold) {
+                        break;
+                    }
+                }
+                const auto now = std::chrono::steady_clock::now();
+                if (now >= deadline) {
+                    break;
+                }
+                wakeup.waitFor(deadline - now);
+            }
+
+            flushBatch();
+
+            std::lock_guard lock { mutex };
+            if (stopping && buffer.empty()) {
+                break;
+            }
+        }
+    }
+
+    void FileAppender::flushBatch()
+    {
+        AppendAwaiter* waiters { nullptr };
+        {
+            std::lock_guard lock { mutex };
+            if (buffer.empty()) {
+                return;
+            }
+            writing.swap(buffer);
+            waiters = std::exchange(waitersHead, nullptr);
+            waitersTail = nullptr;
+        }
+
+        ssize_t error { 0 };
+        size_t written { 0 };
+        while (written < writing.size())
+        {
+            const ssize_t bytes = ::write(fd, writing.data() + written, writing.size() - written);
+            if (bytes < 0) {
+                if (EINTR == errno)
+                    continue;
+                error = -errno;
+                break;
+            }
+            written += static_cast<size_t>(bytes);
+        }
+        if (0 == error && options.durable && ::fdatasync(fd) < 0) {
+            error = -errno;
+        }
+
+        uint64_t appends { 0 };
+        while (waiters)
+        {
+            AppendAwaiter* const next = waiters->nextWaiter;
+            waiters->result = (0 == error) ? static_cast<ssize_t>(waiters->bytes.size()) : error;
+            pool.post(waiters);
+            waiters = next;
+            ++appends;
+        }
+
+        {
+            std::lock_guard lock { mutex };
+            statistics.appends += appends;
+            statistics.bytes += written;
+            ++statistics.batches;
+        }
+        writing.clear();
+    }
+}
@@ -0,0 +1,139 @@
+/**============================================================================
+Name        : FileAppender.h
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : co_await appender.append(bytes): group commit of appends to one file
+============================================================================**/
+
+#ifndef CPPCOROUTINES_FILEAPPENDER_H
+#define CPPCOROUTINES_FILEAPPENDER_H
+
+#include <chrono>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <span>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <sys/types.h>
+
+#include "runtime/ThreadPool.h"
+#include "runtime/WaitEvent.h"
+
+namespace StdCoroutines::Runtime
+{
+    /**
+     * Appends from any number of coroutines are copied into one buffer. A flusher thread writes
+     * the whole buffer with one write() and one fdatasync() once it reaches 'flushThreshold'
+     * bytes or 'flushInterval' after the first append of the batch, whichever comes first.
+     * With the default zero interval a batch is whatever accumulated during the previous
+     * write + fdatasync: no added latency when idle, large batches under load.
+     * Every coroutine of the batch is resumed on the pool only after that: a resumed append
+     * is on disk (durable = true) or at least in the page cache (durable = false).
+    **/
+    class FileAppender
+    {
+    public:
+
+        struct Options
+        {
+            std::chrono::microseconds flushInterval { 0 };
+            size_t flushThreshold { 256 * 1024 };
+            bool durable { true };
+        };
+
+        struct Stats
+        {
+            uint64_t appends { 0 };
+            uint64_t batches { 0 };
+            uint64_t bytes { 0 };
+        };
+
+        struct AppendAwaiter : WorkItem
+        {
+            FileAppender& appender;
+            std::span<const char> bytes;
+            std::coroutine_handle<> continuation {};
+            AppendAwaiter* nextWaiter { nullptr };
+            ssize_t result { 0 };
+
+            AppendAwaiter(FileAppender& appender, const std::span<const char> bytes) noexcept :
+                    WorkItem { nullptr, &resume }, appender { appender }, bytes { bytes } {
+            }
+
+            [[nodiscard]]
+            bool await_ready() const noexcept {
+                /** TRUE ==> await_resume() or in case FALSE ==> await_suspend() will be called **/
+                return bytes.empty();
+            }
+
+            void await_suspend(const std::coroutine_handle<> hInputCoro)
+            {
+                continuation = hInputCoro;
+                appender.enqueue(this);
+            }
+
+            /** Bytes appended, or -errno if the batch could not be written / synced **/
+            [[nodiscard]]
+            ssize_t await_resume() const noexcept {
+                return result;
+            }
+
+            static void resume(WorkItem* item) {
+                static_cast<AppendAwaiter*>(item)->continuation.resume();
+            }
+        };
+
+    private:
+
+        int fd { -1 };
+        Options options;
+        ThreadPool& pool;
+
+        std::mutex mutex;
+        std::vector<char> buffer;
+        AppendAwaiter* waitersHead { nullptr };
+        AppendAwaiter* waitersTail { nullptr };
+        bool stopping { false };
+        Stats statistics;
+
+        /** Batch being written: swapped with 'buffer' so appends continue during the write **/
+        std::vector<char> writing;
+
+        WaitEvent wakeup;
+        std::jthread flusher;
+
+        void enqueue(AppendAwaiter* awaiter);
+        void flushLoop();
+        void flushBatch();
+
+    public:
+
+        /** Opens (creates) 'path' for appending. Throws std::system_error **/
+        FileAppender(const std::filesystem::path& path, const Options& options, ThreadPool& pool = ThreadPool::shared());
+        explicit FileAppender(const std::filesystem::path& path): FileAppender(path, Options {}) {}
+
+        /** Flushes what is buffered and resumes its waiters **/
+        ~FileAppender();
+
+        FileAppender(const FileAppender&) = delete;
+        FileAppender& operator=(const FileAppender&) = delete;
+
+        /** The bytes are copied when the coroutine suspends: the caller's buffer may go away after that **/
+        [[nodiscard]]
+        AppendAwaiter append(const std::string_view bytes) noexcept {
+            return AppendAwaiter { *this, std::span { bytes.data(), bytes.size() } };
+        }
+
+        [[nodiscard]]
+        Stats stats();
+    };
+}
+
+#endif //CPPCOROUTINES_FILEAPPENDER_H
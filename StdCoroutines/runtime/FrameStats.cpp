@@ -0,0 +1,81 @@
+/**============================================================================
+Name        : FrameStats.cpp
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Per coroutine type frame size / allocation / live frames statistics
+============================================================================**/
+
+#include "FrameStats.h"
+
+#include <cxxabi.h>
+#include <cstdlib>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <print>
+
+namespace
+{
+    using StdCoroutines::Runtime::FrameStats::TypeStats;
+
+    std::string demangle(const char* name)
+    {
+        int status { 0 };
+        const std::unique_ptr<char, decltype(&std::free)> demangled {
+            abi::__cxa_demangle(name, nullptr, nullptr, &status), &std::free };
+        return 0 == status && demangled ? std::string { demangled.get() } : std::string { name };
+    }
+
+    struct Registry
+    {
+        std::mutex mutex;
+        std::deque<TypeStats> types;
+
+        ~Registry()
+        {
+            if (!types.empty()) {
+                StdCoroutines::Runtime::FrameStats::printReport();
+            }
+        }
+    };
+
+    Registry& registry()
+    {
+        static Registry instance;
+        return instance;
+    }
+}
+
+namespace StdCoroutines::Runtime::FrameStats
+{
+    TypeStats& registerType(const std::type_info& type)
+    {
+        Registry& reg = registry();
+        std::lock_guard lock { reg.mutex };
+        TypeStats& stats = reg.types.emplace_back();
+        stats.name = demangle(type.name());
+        return stats;
+    }
+
+    void printReport()
+    {
+        Registry& reg = registry();
+        std::lock_guard lock { reg.mutex };
+
+        std::println("{:<64} {:>10} {:>12} {:>8} {:>12} {:>10} {:>10}",
+                     "coroutine type", "frames", "allocations", "elided", "frame size", "live", "peak live");
+        for (const TypeStats& stats: reg.types)
+        {
+            const uint64_t frames = stats.frames.load(), allocations = stats.allocations.load();
+            const size_t minSize = stats.minFrameSize.load(), maxSize = stats.maxFrameSize.load();
+            const std::string frameSize = 0 == allocations ? std::string { "-" }
+                : minSize == maxSize ? std::to_string(maxSize) : std::format("{}..{}", minSize, maxSize);
+
+            std::println("{:<64} {:>10} {:>12} {:>8} {:>12} {:>10} {:>10}",
+                         stats.name, frames, allocations, frames >= allocations ? frames - allocations : 0,
+                         frameSize, stats.live.load(), stats.peakLive.load());
+        }
+    }
+}
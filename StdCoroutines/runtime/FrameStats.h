@@ -0,0 +1,102 @@
+/**============================================================================
+Name        : FrameStats.h
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Per coroutine type frame size / allocation / live frames statistics
+============================================================================**/
+
+#ifndef CPPCOROUTINES_FRAMESTATS_H
+#define CPPCOROUTINES_FRAMESTATS_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <string>
+#include <typeinfo>
+
+/** 1 - promise types deriving from FrameStats::Tracked<> count their frames, 0 - the mixin is empty **/
+#ifndef CORO_FRAME_STATS
+#define CORO_FRAME_STATS 0
+#endif
+
+namespace StdCoroutines::Runtime::FrameStats
+{
+    struct TypeStats
+    {
+        std::string name;
+
+        std::atomic<uint64_t> frames { 0 };       // promise objects constructed (heap or elided frames)
+        std::atomic<uint64_t> allocations { 0 };  // promise_type::operator new calls
+        std::atomic<uint64_t> bytes { 0 };
+        std::atomic<uint64_t> live { 0 };
+        std::atomic<uint64_t> peakLive { 0 };
+        std::atomic<size_t> minFrameSize { std::numeric_limits<size_t>::max() };
+        std::atomic<size_t> maxFrameSize { 0 };
+
+        void onCreate() noexcept
+        {
+            frames.fetch_add(1, std::memory_order_relaxed);
+            const uint64_t current = live.fetch_add(1, std::memory_order_relaxed) + 1;
+            uint64_t peak = peakLive.load(std::memory_order_relaxed);
+            while (current > peak && !peakLive.compare_exchange_weak(peak, current, std::memory_order_relaxed)) {
+            }
+        }
+
+        void onDestroy() noexcept {
+            live.fetch_sub(1, std::memory_order_relaxed);
+        }
+
+        void onAllocate(const size_t size) noexcept
+        {
+            allocations.fetch_add(1, std::memory_order_relaxed);
+            bytes.fetch_add(size, std::memory_order_relaxed);
+            size_t value = minFrameSize.load(std::memory_order_relaxed);
+            while (size < value && !minFrameSize.compare_exchange_weak(value, size, std::memory_order_relaxed)) {
+            }
+            value = maxFrameSize.load(std::memory_order_relaxed);
+            while (size > value && !maxFrameSize.compare_exchange_weak(value, size, std::memory_order_relaxed)) {
+            }
+        }
+    };
+
+    /** Returned objects live until the end of the program, the table is printed at exit **/
+    TypeStats& registerType(const std::type_info& type);
+
+    void printReport();
+
+    /**
+     * Usage: struct promise_type : FrameStats::Tracked<Average> { ... };
+     * frames - allocations == frames whose allocation was elided (HALO)
+    **/
+    template<typename Coroutine>
+    struct Tracked
+    {
+#if CORO_FRAME_STATS
+        inline static TypeStats& stats = registerType(typeid(Coroutine));
+
+        Tracked() noexcept {
+            stats.onCreate();
+        }
+
+        ~Tracked() {
+            stats.onDestroy();
+        }
+
+        static void* operator new(const std::size_t size)
+        {
+            stats.onAllocate(size);
+            return ::operator new(size);
+        }
+
+        static void operator delete(void* ptr, const std::size_t size) noexcept {
+            ::operator delete(ptr, size);
+        }
+#endif
+    };
+}
+
+#endif //CPPCOROUTINES_FRAMESTATS_H
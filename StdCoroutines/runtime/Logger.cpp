@@ -0,0 +1,152 @@
+/**============================================================================
+Name        : Logger.cpp
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Asynchronous low-overhead logger
+============================================================================**/
+
+#include "Logger.h"
+#include "Utilities.h"
+
+#include <cstdio>
+#include <mutex>
+#include <vector>
+
+namespace
+{
+    using namespace StdCoroutines::Runtime::Log;
+    using namespace std::chrono_literals;
+
+    constexpr std::array<std::string_view, 6> levelNames { "TRACE", "DEBUG", "INFO", "WARN", "ERROR", "OFF" };
+
+    class Backend
+    {
+        std::mutex registryMutex;
+        std::vector<std::shared_ptr<RingBuffer>> buffers;
+
+        /** Only one consumer is allowed at a time: the worker or a thread calling flush() **/
+        std::mutex drainMutex;
+        std::string output;
+        uint64_t retiredDropped { 0 };
+
+        std::jthread worker;
+
+        bool drain()
+        {
+            std::vector<std::shared_ptr<RingBuffer>> snapshot;
+            {
+                std::lock_guard lock { registryMutex };
+                snapshot = buffers;
+            }
+
+            std::lock_guard lock { drainMutex };
+            bool written = false;
+            for (const std::shared_ptr<RingBuffer>& buffer: snapshot)
+            {
+                while (const Record* record = buffer->peek())
+                {
+                    std::format_to(std::back_inserter(output), "[{}] [{}] [{}] ", record->threadId,
+                                   Utilities::getCurrentTime(record->timestamp),
+                                   levelNames[static_cast<size_t>(record->level)]);
+                    record->decode(*record, output);
+                    output.push_back('\n');
+                    buffer->release();
+                    written = true;
+                }
+            }
+
+            if (written) {
+                std::fwrite(output.data(), 1, output.size(), stdout);
+                std::fflush(stdout);
+                output.clear();
+            }
+
+            std::lock_guard registryLock { registryMutex };
+            std::erase_if(buffers, [this](const std::shared_ptr<RingBuffer>& buffer) {
+                if (buffer->retired.load(std::memory_order_acquire) && nullptr == buffer->peek()) {
+                    retiredDropped += buffer->dropped();
+                    return true;
+                }
+                return false;
+            });
+            return written;
+        }
+
+    public:
+
+        Backend(): worker { [this](const std::stop_token& token) {
+            while (!token.stop_requested()) {
+                if (!drain()) {
+                    std::this_thread::sleep_for(1ms);
+                }
+            }
+        }}
+        {
+        }
+
+        ~Backend()
+        {
+            worker.request_stop();
+            worker.join();
+            drain();
+        }
+
+        std::shared_ptr<RingBuffer> attach()
+        {
+            auto buffer = std::make_shared<RingBuffer>();
+            std::lock_guard lock { registryMutex };
+            buffers.push_back(buffer);
+            return buffer;
+        }
+
+        void flush() {
+            drain();
+        }
+
+        uint64_t dropped()
+        {
+            std::lock_guard lock { registryMutex };
+            uint64_t count = retiredDropped;
+            for (const std::shared_ptr<RingBuffer>& buffer: buffers)
+                count += buffer->dropped();
+            return count;
+        }
+    };
+
+    Backend& backend()
+    {
+        static Backend instance;
+        return instance;
+    }
+
+    /** Keeps the ring alive until the backend has drained it, even after the owning thread exits **/
+    struct ThreadBuffer
+    {
+        std::shared_ptr<RingBuffer> buffer { backend().attach() };
+
+        ~ThreadBuffer() {
+            buffer->retired.store(true, std::memory_order_release);
+        }
+    };
+}
+
+namespace StdCoroutines::Runtime::Log
+{
+    RingBuffer& threadBuffer()
+    {
+        thread_local ThreadBuffer local;
+        return *local.buffer;
+    }
+
+    void flush()
+    {
+        backend().flush();
+    }
+
+    uint64_t dropped()
+    {
+        return backend().dropped();
+    }
+}
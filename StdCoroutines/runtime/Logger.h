@@ -0,0 +1,235 @@
+/**============================================================================
+Name        : Logger.h
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Asynchronous low-overhead logger
+============================================================================**/
+
+#ifndef CPPCOROUTINES_LOGGER_H
+#define CPPCOROUTINES_LOGGER_H
+
+#include <algorithm>
+#include <atomic>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <memory>
+#include <new>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+
+/**
+ * Records below this level are removed at compile time: 0 - Trace, 1 - Debug, 2 - Info, 3 - Warning, 4 - Error
+**/
+#ifndef CORO_LOG_LEVEL
+#define CORO_LOG_LEVEL 2
+#endif
+
+namespace StdCoroutines::Runtime::Log
+{
+    enum class Level : uint8_t
+    {
+        Trace,
+        Debug,
+        Info,
+        Warning,
+        Error,
+        Off
+    };
+
+    inline constexpr Level compiledLevel { static_cast<Level>(CORO_LOG_LEVEL) };
+
+    /** Strings are copied (and truncated) into the record, the backend never touches caller memory **/
+    struct InlineString
+    {
+        static constexpr size_t capacity { 47 };
+
+        uint8_t size { 0 };
+        char data[capacity] {};
+
+        explicit InlineString(const std::string_view str) noexcept:
+            size { static_cast<uint8_t>(std::min(str.size(), capacity)) } {
+            std::copy_n(str.data(), size, data);
+        }
+
+        [[nodiscard]]
+        std::string_view view() const noexcept {
+            return { data, size };
+        }
+    };
+
+    struct Record
+    {
+        static constexpr size_t size { 256 };
+
+        using Decoder = void (*)(const Record&, std::string&);
+
+        Decoder decode { nullptr };
+        std::string_view format;
+        std::chrono::system_clock::time_point timestamp;
+        std::thread::id threadId;
+        Level level { Level::Info };
+
+        alignas(std::max_align_t) std::byte payload[size - 48];
+    };
+    static_assert(sizeof(Record) == Record::size);
+
+    /** Single producer (the owning thread) / single consumer (the backend) ring of fixed size records **/
+    class RingBuffer
+    {
+        static constexpr size_t capacity { 1024 };
+        static constexpr size_t mask { capacity - 1 };
+        static_assert((capacity & mask) == 0);
+
+        std::array<Record, capacity> records;
+
+        alignas(64) std::atomic<size_t> head { 0 };
+        alignas(64) std::atomic<size_t> tail { 0 };
+        size_t cachedHead { 0 };
+        std::atomic<uint64_t> droppedCount { 0 };
+
+    public:
+
+        std::atomic<bool> retired { false };
+
+        [[nodiscard]]
+        Record* tryAcquire() noexcept
+        {
+            const size_t pos = tail.load(std::memory_order_relaxed);
+            if (pos - cachedHead == capacity)
+            {
+                cachedHead = head.load(std::memory_order_acquire);
+                if (pos - cachedHead == capacity) {
+                    droppedCount.fetch_add(1, std::memory_order_relaxed);
+                    return nullptr;
+                }
+            }
+            return &records[pos & mask];
+        }
+
+        void commit() noexcept {
+            tail.store(tail.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+        }
+
+        [[nodiscard]]
+        const Record* peek() const noexcept
+        {
+            const size_t pos = head.load(std::memory_order_relaxed);
+            return pos == tail.load(std::memory_order_acquire) ? nullptr : &records[pos & mask];
+        }
+
+        void release() noexcept {
+            head.store(head.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+        }
+
+        [[nodiscard]]
+        uint64_t dropped() const noexcept {
+            return droppedCount.load(std::memory_order_relaxed);
+        }
+    };
+
+    /** Returns the ring of the calling thread. The first call registers the thread and allocates the ring **/
+    RingBuffer& threadBuffer();
+
+    /** Formats everything written so far. Blocking - not for coroutine hot paths **/
+    void flush();
+
+    [[nodiscard]]
+    uint64_t dropped();
+}
+
+namespace StdCoroutines::Runtime::Log::Details
+{
+    template<typename T>
+    auto store(const T& value) noexcept
+    {
+        if constexpr (std::is_convertible_v<const T&, std::string_view>)
+            return InlineString { std::string_view { value } };
+        else
+            return value;
+    }
+
+    template<typename T>
+    using StoredType = decltype(store(std::declval<const T&>()));
+
+    template<typename... Stored>
+    void decode(const Record& record, std::string& out)
+    {
+        const auto& args = *std::launder(reinterpret_cast<const std::tuple<Stored...>*>(record.payload));
+        std::apply([&](const auto&... values) {
+            std::vformat_to(std::back_inserter(out), record.format, std::make_format_args(values...));
+        }, args);
+    }
+
+    template<Level level, typename... Args>
+    void write(const std::string_view format, const Args&... args) noexcept
+    {
+        using Payload = std::tuple<StoredType<Args>...>;
+        static_assert(sizeof(Payload) <= sizeof(Record::payload), "Too many arguments for a single log record");
+        static_assert(std::is_trivially_destructible_v<Payload>);
+
+        RingBuffer& buffer = threadBuffer();
+        Record* record = buffer.tryAcquire();
+        if (nullptr == record) {
+            return;
+        }
+
+        record->decode = &decode<StoredType<Args>...>;
+        record->format = format;
+        record->timestamp = std::chrono::system_clock::now();
+        record->threadId = std::this_thread::get_id();
+        record->level = level;
+        ::new (record->payload) Payload { store(args)... };
+        buffer.commit();
+    }
+}
+
+namespace StdCoroutines::Runtime::Log
+{
+    template<typename... Args>
+    void trace(const std::format_string<const Args&...> format, const Args&... args) noexcept {
+        if constexpr (compiledLevel <= Level::Trace)
+            Details::write<Level::Trace, Args...>(format.get(), args...);
+    }
+
+    template<typename... Args>
+    void debug(const std::format_string<const Args&...> format, const Args&... args) noexcept {
+        if constexpr (compiledLevel <= Level::Debug)
+            Details::write<Level::Debug, Args...>(format.get(), args...);
+    }
+
+    template<typename... Args>
+    void info(const std::format_string<const Args&...> format, const Args&... args) noexcept {
+        if constexpr (compiledLevel <= Level::Info)
+            Details::write<Level::Info, Args...>(format.get(), args...);
+    }
+
+    template<typename... Args>
+    void warning(const std::format_string<const Args&...> format, const Args&... args) noexcept {
+        if constexpr (compiledLevel <= Level::Warning)
+            Details::write<Level::Warning, Args...>(format.get(), args...);
+    }
+
+    template<typename... Args>
+    void error(const std::format_string<const Args&...> format, const Args&... args) noexcept {
+        if constexpr (compiledLevel <= Level::Error)
+            Details::write<Level::Error, Args...>(format.get(), args...);
+    }
+}
+
+template<>
+struct std::formatter<StdCoroutines::Runtime::Log::InlineString> : std::formatter<std::string_view>
+{
+    auto format(const StdCoroutines::Runtime::Log::InlineString& str, std::format_context& ctx) const {
+        return std::formatter<std::string_view>::format(str.view(), ctx);
+    }
+};
+
+#endif //CPPCOROUTINES_LOGGER_H
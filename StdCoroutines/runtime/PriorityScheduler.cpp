@@ -0,0 +1,191 @@
+/**============================================================================
+Name        : PriorityScheduler.cpp
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Worker pool with per-worker priority run queues and aging
+============================================================================**/
+
+#include "PriorityScheduler.h"
+
+#include <algorithm>
+
+namespace
+{
+    struct CurrentWorker
+    {
+        const StdCoroutines::Runtime::PriorityScheduler* scheduler { nullptr };
+        size_t index { 0 };
+    };
+
+    thread_local CurrentWorker currentWorker {};
+}
+
+namespace StdCoroutines::Runtime
+{
+    PriorityScheduler::PriorityScheduler(const Options& options): options { options }
+    {
+        this->options.agedEvery = std::max<uint32_t>(1, options.agedEvery);
+        workersCount = std::max<size_t>(1, options.threads);
+        workers = std::make_unique<Worker[]>(workersCount);
+        threads.reserve(workersCount);
+        for (size_t idx = 0; idx < workersCount; ++idx) {
+            threads.emplace_back([this, idx] { workerLoop(idx); });
+        }
+    }
+
+    PriorityScheduler::~PriorityScheduler()
+    {
+        {
+            std::lock_guard lock { sleepMutex };
+            stopping = true;
+        }
+        available.notify_all();
+        threads.clear();
+    }
+
+    void PriorityScheduler::post(PriorityItem* item) noexcept
+    {
+        item->next = nullptr;
+        item->enqueued = std::chrono::steady_clock::now();
+
+        const size_t index = this == currentWorker.scheduler ? currentWorker.index
+                : nextWorker.fetch_add(1, std::memory_order_relaxed) % workersCount;
+        const size_t level = static_cast<size_t>(item->priority);
+        Worker& worker = workers[index];
+
+        /** Counted before it is visible: a worker that takes it at once never sees 'pending' wrap below zero.
+         *  seq_cst pairs with the sleeping worker: it bumps 'idleWorkers', then re-checks 'pending' **/
+        pending.fetch_add(1, std::memory_order_seq_cst);
+        {
+            std::lock_guard lock { worker.mutex };
+            Queue& queue = worker.queues[level];
+            if (queue.tail) {
+                queue.tail->next = item;
+            } else {
+                queue.head = item;
+            }
+            queue.tail = item;
+            worker.sizes[level].fetch_add(1, std::memory_order_relaxed);
+        }
+
+        if (idleWorkers.load(std::memory_order_seq_cst) > 0)
+        {
+            std::lock_guard lock { sleepMutex };
+            available.notify_one();
+        }
+    }
+
+    PriorityItem* PriorityScheduler::popFront(Worker& worker, const size_t level) noexcept
+    {
+        if (0 == worker.sizes[level].load(std::memory_order_relaxed)) {
+            return nullptr;
+        }
+        std::lock_guard lock { worker.mutex };
+        Queue& queue = worker.queues[level];
+        PriorityItem* const item = queue.head;
+        if (item)
+        {
+            queue.head = static_cast<PriorityItem*>(item->next);
+            if (!queue.head) {
+                queue.tail = nullptr;
+            }
+            worker.sizes[level].fetch_sub(1, std::memory_order_relaxed);
+        }
+        return item;
+    }
+
+    PriorityItem* PriorityScheduler::popAged(const size_t index)
+    {
+        Worker& worker = workers[index];
+        const auto now = std::chrono::steady_clock::now();
+        for (size_t level = levelsCount - 1; level > 0; --level)
+        {
+            if (0 == worker.sizes[level].load(std::memory_order_relaxed)) {
+                continue;
+            }
+            std::lock_guard lock { worker.mutex };
+            Queue& queue = worker.queues[level];
+            PriorityItem* const item = queue.head;
+            if (item && now - item->enqueued >= options.agingAfter * level)
+            {
+                queue.head = static_cast<PriorityItem*>(item->next);
+                if (!queue.head) {
+                    queue.tail = nullptr;
+                }
+                worker.sizes[level].fetch_sub(1, std::memory_order_relaxed);
+                return item;
+            }
+        }
+        return nullptr;
+    }
+
+    PriorityItem* PriorityScheduler::pop(const size_t index)
+    {
+        Worker& own = workers[index];
+        if (++own.picks >= options.agedEvery)
+        {
+            own.picks = 0;
+            if (PriorityItem* const item = popAged(index)) {
+                own.aged.fetch_add(1, std::memory_order_relaxed);
+                return item;
+            }
+        }
+
+        for (size_t level = 0; level < levelsCount; ++level)
+        {
+            if (PriorityItem* const item = popFront(own, level)) {
+                return item;
+            }
+            for (size_t step = 1; step < workersCount; ++step)
+            {
+                if (PriorityItem* const item = popFront(workers[(index + step) % workersCount], level)) {
+                    own.stolen.fetch_add(1, std::memory_order_relaxed);
+                    return item;
+                }
+            }
+        }
+        return nullptr;
+    }
+
+    void PriorityScheduler::workerLoop(const size_t index)
+    {
+        currentWorker = CurrentWorker { this, index };
+        Worker& own = workers[index];
+        while (true)
+        {
+            if (PriorityItem* const item = pop(index))
+            {
+                pending.fetch_sub(1, std::memory_order_relaxed);
+                own.executed[static_cast<size_t>(item->priority)].fetch_add(1, std::memory_order_relaxed);
+                item->execute(item);
+                continue;
+            }
+
+            std::unique_lock lock { sleepMutex };
+            idleWorkers.fetch_add(1, std::memory_order_seq_cst);
+            while (0 == pending.load(std::memory_order_seq_cst) && !stopping) {
+                available.wait(lock);
+            }
+            idleWorkers.fetch_sub(1, std::memory_order_relaxed);
+            if (stopping && 0 == pending.load(std::memory_order_seq_cst)) {
+                return;
+            }
+        }
+    }
+
+    PriorityScheduler::Stats PriorityScheduler::stats() const noexcept
+    {
+        Stats total;
+        for (size_t idx = 0; idx < workersCount; ++idx)
+        {
+            for (size_t level = 0; level < levelsCount; ++level) {
+                total.executed[level] += workers[idx].executed[level].load(std::memory_order_relaxed);
+            }
+            total.aged += workers[idx].aged.load(std::memory_order_relaxed);
+            total.stolen += workers[idx].stolen.load(std::memory_order_relaxed);
+        }
+        return total;
+    }
+}
@@ -0,0 +1,200 @@
+/**============================================================================
+Name        : PriorityScheduler.h
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Worker pool with per-worker priority run queues and aging
+============================================================================**/
+
+#ifndef CPPCOROUTINES_PRIORITYSCHEDULER_H
+#define CPPCOROUTINES_PRIORITYSCHEDULER_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+#include "runtime/Task.h"
+#include "runtime/ThreadPool.h"
+
+namespace StdCoroutines::Runtime
+{
+    /** WorkItem with the level it was posted at and the time it was queued (for aging) **/
+    struct PriorityItem : WorkItem
+    {
+        std::chrono::steady_clock::time_point enqueued {};
+        Priority priority { Priority::Normal };
+    };
+
+    /**
+     * Every worker owns one FIFO per priority level. Posts from a worker go to its own queues,
+     * posts from other threads are spread round robin. A worker takes the highest non-empty
+     * level of its own queues, then steals that level from the others, then goes one level down.
+     *
+     * Aging: a lower level item queued for longer than 'agingAfter' (times its level) gets every
+     * 'agedEvery'-th pick of its worker even while higher levels stay busy. Starved work keeps
+     * a bounded share of the throughput and high priority latency stays bounded as well.
+    **/
+    class PriorityScheduler
+    {
+    public:
+
+        static constexpr size_t levelsCount { 3 };
+
+        struct Options
+        {
+            size_t threads { std::thread::hardware_concurrency() };
+            std::chrono::milliseconds agingAfter { 50 };
+            uint32_t agedEvery { 8 };
+        };
+
+        struct Stats
+        {
+            std::array<uint64_t, levelsCount> executed {};
+            uint64_t aged { 0 };
+            uint64_t stolen { 0 };
+        };
+
+        /** co_await scheduler.schedule(): continue on a worker at the awaiting task's promise priority **/
+        struct ScheduleAwaiter : PriorityItem
+        {
+            PriorityScheduler& scheduler;
+            std::optional<Priority> explicitPriority {};
+            std::coroutine_handle<> continuation {};
+
+            ScheduleAwaiter(PriorityScheduler& scheduler, const std::optional<Priority> priority) noexcept :
+                    PriorityItem { { nullptr, &resume } }, scheduler { scheduler }, explicitPriority { priority } {
+            }
+
+            [[nodiscard]]
+            bool await_ready() const noexcept {
+                /** TRUE ==> await_resume() or in case FALSE ==> await_suspend() will be called **/
+                return false;
+            }
+
+            template<typename Promise>
+            void await_suspend(const std::coroutine_handle<Promise> hInputCoro) noexcept
+            {
+                continuation = hInputCoro;
+                if (explicitPriority) {
+                    priority = *explicitPriority;
+                } else if constexpr (requires { hInputCoro.promise().priority; }) {
+                    priority = hInputCoro.promise().priority;
+                }
+                scheduler.post(this);
+            }
+
+            void await_resume() const noexcept {
+            }
+
+            static void resume(WorkItem* item) {
+                static_cast<ScheduleAwaiter*>(item)->continuation.resume();
+            }
+        };
+
+    private:
+
+        static constexpr size_t cacheLineSize { 64 };
+
+        struct Queue
+        {
+            PriorityItem* head { nullptr };
+            PriorityItem* tail { nullptr };
+        };
+
+        struct alignas(cacheLineSize) Worker
+        {
+            std::mutex mutex;
+            std::array<Queue, levelsCount> queues {};
+
+            /** Lets the others skip an empty level without taking 'mutex' **/
+            std::array<std::atomic<uint32_t>, levelsCount> sizes {};
+
+            uint32_t picks { 0 };
+            std::array<std::atomic<uint64_t>, levelsCount> executed {};
+            std::atomic<uint64_t> aged { 0 };
+            std::atomic<uint64_t> stolen { 0 };
+        };
+
+        Options options;
+        std::unique_ptr<Worker[]> workers;
+        size_t workersCount { 0 };
+        std::atomic<size_t> nextWorker { 0 };
+
+        /** Items queued anywhere: workers sleep only when it is zero **/
+        alignas(cacheLineSize) std::atomic<size_t> pending { 0 };
+        std::atomic<size_t> idleWorkers { 0 };
+        std::mutex sleepMutex;
+        std::condition_variable available;
+        bool stopping { false };
+
+        std::vector<std::jthread> threads;
+
+        void workerLoop(size_t index);
+
+        [[nodiscard]]
+        PriorityItem* pop(size_t index);
+
+        [[nodiscard]]
+        static PriorityItem* popFront(Worker& worker, size_t level) noexcept;
+
+        [[nodiscard]]
+        PriorityItem* popAged(size_t index);
+
+    public:
+
+        explicit PriorityScheduler(const Options& options);
+        PriorityScheduler(): PriorityScheduler(Options {}) {}
+
+        /** Runs everything already posted, then joins the workers **/
+        ~PriorityScheduler();
+
+        PriorityScheduler(const PriorityScheduler&) = delete;
+        PriorityScheduler& operator=(const PriorityScheduler&) = delete;
+
+        [[nodiscard]]
+        size_t size() const noexcept {
+            return workersCount;
+        }
+
+        /** No allocation: the item must stay alive until its execute() has been called **/
+        void post(PriorityItem* item) noexcept;
+
+        /** At the awaiting task's promise priority (Priority::Normal for other coroutine types) **/
+        [[nodiscard]]
+        ScheduleAwaiter schedule() noexcept {
+            return ScheduleAwaiter { *this, std::nullopt };
+        }
+
+        [[nodiscard]]
+        ScheduleAwaiter schedule(const Priority priority) noexcept {
+            return ScheduleAwaiter { *this, priority };
+        }
+
+        [[nodiscard]]
+        Stats stats() const noexcept;
+    };
+
+    /** Sets the priority a not yet started task is scheduled with: spawn(with_priority(request(), Priority::High)) **/
+    template<typename T>
+    [[nodiscard]]
+    Task<T> with_priority(Task<T> task, const Priority priority)
+    {
+        if (!task.handle()) {
+            throw std::logic_error("with_priority: empty task");
+        }
+        task.handle().promise().priority = priority;
+        return task;
+    }
+}
+
+#endif //CPPCOROUTINES_PRIORITYSCHEDULER_H
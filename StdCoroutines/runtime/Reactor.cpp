@@ -0,0 +1,354 @@
+/**============================================================================
+Name        : Reactor.cpp
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Edge-triggered epoll reactor with awaitable accept/connect/read/write
+============================================================================**/
+
+#include "Reactor.h"
+
+#include <arpa/inet.h>
+#include <cerrno>
+#include <fcntl.h>
+#include <netinet/tcp.h>
+#include <sys/eventfd.h>
+#include <system_error>
+#include <unistd.h>
+
+namespace
+{
+    using StdCoroutines::Runtime::IoOperation;
+    using StdCoroutines::Runtime::Socket;
+
+    Socket::Awaiter& awaiter(IoOperation* operation) noexcept {
+        return *static_cast<Socket::Awaiter*>(operation);
+    }
+
+    /** Common tail of every attempt: EAGAIN keeps the operation parked, anything else completes it **/
+    bool finish(IoOperation* operation, const ssize_t value) noexcept
+    {
+        if (value >= 0) {
+            operation->result = value;
+            return true;
+        }
+        if (EAGAIN == errno || EWOULDBLOCK == errno) {
+            return false;
+        }
+        operation->result = -errno;
+        return true;
+    }
+
+    bool tryAccept(IoOperation* operation) noexcept
+    {
+        const int fd = ::accept4(awaiter(operation).socket.descriptor(), nullptr, nullptr,
+                                 SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (fd >= 0) {
+            constexpr int enable { 1 };
+            ::setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &enable, sizeof(enable));
+        }
+        return finish(operation, fd);
+    }
+
+    bool finishConnect(IoOperation* operation) noexcept
+    {
+        const int fd = awaiter(operation).socket.descriptor();
+        int error { 0 };
+        socklen_t length { sizeof(error) };
+        if (::getsockopt(fd, SOL_SOCKET, SO_ERROR, &error, &length) < 0) {
+            error = errno;
+        }
+        if (0 != error) {
+            operation->result = -error;
+            return true;
+        }
+
+        /** An edge reported before the handshake completed: keep waiting **/
+        sockaddr_in peer {};
+        socklen_t peerLength { sizeof(peer) };
+        if (::getpeername(fd, reinterpret_cast<sockaddr*>(&peer), &peerLength) < 0)
+        {
+            if (ENOTCONN == errno) {
+                return false;
+            }
+            operation->result = -errno;
+            return true;
+        }
+        operation->result = 0;
+        return true;
+    }
+
+    bool tryConnect(IoOperation* operation) noexcept
+    {
+        Socket::Awaiter& self = awaiter(operation);
+        if (0 == ::connect(self.socket.descriptor(), static_cast<const sockaddr*>(self.buffer), self.size)) {
+            operation->result = 0;
+            return true;
+        }
+        if (EINPROGRESS == errno) {
+            operation->attempt = &finishConnect;
+            return false;
+        }
+        operation->result = -errno;
+        return true;
+    }
+
+    bool edgeArrived(IoOperation* operation) noexcept
+    {
+        operation->result = 0;
+        return true;
+    }
+
+    /** The first attempt (from await_ready) always parks: only the next edge completes it **/
+    bool awaitEdge(IoOperation* operation) noexcept
+    {
+        operation->attempt = &edgeArrived;
+        return false;
+    }
+
+    bool tryRead(IoOperation* operation) noexcept
+    {
+        Socket::Awaiter& self = awaiter(operation);
+        return finish(operation, ::recv(self.socket.descriptor(), self.buffer, self.size, 0));
+    }
+
+    bool tryWrite(IoOperation* operation) noexcept
+    {
+        Socket::Awaiter& self = awaiter(operation);
+        return finish(operation, ::send(self.socket.descriptor(), self.buffer, self.size, MSG_NOSIGNAL));
+    }
+
+    /** 'result' accumulates the bytes written so far, 'buffer' / 'size' track the remainder **/
+    bool tryWriteAll(IoOperation* operation) noexcept
+    {
+        Socket::Awaiter& self = awaiter(operation);
+        while (self.size > 0)
+        {
+            const ssize_t written = ::send(self.socket.descriptor(), self.buffer, self.size, MSG_NOSIGNAL);
+            if (written < 0)
+            {
+                if (EAGAIN == errno || EWOULDBLOCK == errno) {
+                    return false;
+                }
+                operation->result = -errno;
+                return true;
+            }
+            self.buffer = static_cast<char*>(self.buffer) + written;
+            self.size -= static_cast<size_t>(written);
+            operation->result += written;
+        }
+        return true;
+    }
+}
+
+namespace StdCoroutines::Runtime
+{
+    Socket::Socket(Reactor& reactor, const int fd): reactor { reactor }, fd { fd }
+    {
+        if (const int flags = ::fcntl(fd, F_GETFL); !(flags & O_NONBLOCK)) {
+            ::fcntl(fd, F_SETFL, flags | O_NONBLOCK);
+        }
+        try {
+            reactor.add(*this);
+        } catch (...) {
+            ::close(fd);
+            throw;
+        }
+    }
+
+    Socket::~Socket()
+    {
+        reactor.remove(*this);
+        ::close(fd);
+    }
+
+    Socket::Awaiter Socket::accept() noexcept {
+        return Awaiter { *this, &Socket::reader, &tryAccept, nullptr, 0 };
+    }
+
+    Socket::Awaiter Socket::connect(const sockaddr_in& address) noexcept {
+        return Awaiter { *this, &Socket::writer, &tryConnect, const_cast<sockaddr_in*>(&address), sizeof(address) };
+    }
+
+    Socket::Awaiter Socket::readable() noexcept {
+        return Awaiter { *this, &Socket::reader, &awaitEdge, nullptr, 0 };
+    }
+
+    Socket::Awaiter Socket::read(const std::span<char> buffer) noexcept {
+        return Awaiter { *this, &Socket::reader, &tryRead, buffer.data(), buffer.size() };
+    }
+
+    Socket::Awaiter Socket::write(const std::span<const char> buffer) noexcept {
+        return Awaiter { *this, &Socket::writer, &tryWrite, const_cast<char*>(buffer.data()), buffer.size() };
+    }
+
+    Socket::Awaiter Socket::writeAll(const std::span<const char> buffer) noexcept {
+        return Awaiter { *this, &Socket::writer, &tryWriteAll, const_cast<char*>(buffer.data()), buffer.size() };
+    }
+
+
+    Reactor::Reactor(const size_t maxEvents): events(maxEvents)
+    {
+        epollFd = ::epoll_create1(EPOLL_CLOEXEC);
+        if (epollFd < 0) {
+            throw std::system_error(errno, std::system_category(), "epoll_create1");
+        }
+        wakeFd = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        if (wakeFd < 0) {
+            const int error = errno;
+            ::close(epollFd);
+            throw std::system_error(error, std::system_category(), "eventfd");
+        }
+
+        /** The wakeup descriptor is the only entry with a null pointer **/
+        epoll_event event { .events = EPOLLIN, .data = { .ptr = nullptr } };
+        ::epoll_ctl(epollFd, EPOLL_CTL_ADD, wakeFd, &event);
+    }
+
+    Reactor::~Reactor()
+    {
+        ::close(wakeFd);
+        ::close(epollFd);
+    }
+
+    void Reactor::add(Socket& socket)
+    {
+        epoll_event event { .events = EPOLLIN | EPOLLOUT | EPOLLRDHUP | EPOLLET, .data = { .ptr = &socket } };
+        if (::epoll_ctl(epollFd, EPOLL_CTL_ADD, socket.fd, &event) < 0) {
+            throw std::system_error(errno, std::system_category(), "epoll_ctl");
+        }
+    }
+
+    void Reactor::remove(Socket& socket) noexcept
+    {
+        ::epoll_ctl(epollFd, EPOLL_CTL_DEL, socket.fd, nullptr);
+
+        /** A coroutine resumed from this batch closed the socket: drop its not yet processed events **/
+        for (size_t idx = processed + 1; idx < received; ++idx) {
+            if (events[idx].data.ptr == &socket) {
+                events[idx].events = 0;
+            }
+        }
+    }
+
+    std::coroutine_handle<> Reactor::complete(Socket& socket, IoOperation* Socket::* slot) noexcept
+    {
+        IoOperation* const operation = socket.*slot;
+        if (nullptr == operation || !operation->attempt(operation)) {
+            return {};
+        }
+        socket.*slot = nullptr;
+        return operation->continuation;
+    }
+
+    void Reactor::poll(const int timeoutMs)
+    {
+        const int count = ::epoll_wait(epollFd, events.data(), static_cast<int>(events.size()), timeoutMs);
+        if (count < 0)
+        {
+            if (EINTR == errno) {
+                return;
+            }
+            throw std::system_error(errno, std::system_category(), "epoll_wait");
+        }
+
+        received = static_cast<size_t>(count);
+        for (processed = 0; processed < received; ++processed)
+        {
+            const epoll_event event = events[processed];
+            if (0 == event.events) {
+                continue;
+            }
+            if (nullptr == event.data.ptr) {
+                uint64_t value { 0 };
+                [[maybe_unused]] const auto bytes = ::read(wakeFd, &value, sizeof(value));
+                continue;
+            }
+
+            /** Both continuations are taken before either runs: the first may destroy the socket **/
+            Socket& socket = *static_cast<Socket*>(event.data.ptr);
+            const std::coroutine_handle<> reader = (event.events & (EPOLLIN | EPOLLRDHUP | EPOLLERR | EPOLLHUP))
+                    ? complete(socket, &Socket::reader) : nullptr;
+            const std::coroutine_handle<> writer = (event.events & (EPOLLOUT | EPOLLERR | EPOLLHUP))
+                    ? complete(socket, &Socket::writer) : nullptr;
+            if (reader) {
+                reader.resume();
+            }
+            if (writer) {
+                writer.resume();
+            }
+        }
+        received = 0;
+        processed = 0;
+    }
+
+    void Reactor::run()
+    {
+        while (!stopping.load(std::memory_order_acquire)) {
+            poll(-1);
+        }
+    }
+
+    bool Reactor::runFor(const std::chrono::milliseconds duration)
+    {
+        using Clock = std::chrono::steady_clock;
+        const Clock::time_point until = Clock::now() + duration;
+        while (!stopping.load(std::memory_order_acquire))
+        {
+            const auto left = std::chrono::ceil<std::chrono::milliseconds>(until - Clock::now());
+            if (left.count() <= 0) {
+                return true;
+            }
+            poll(static_cast<int>(left.count()));
+        }
+        return false;
+    }
+
+    void Reactor::stop() noexcept
+    {
+        stopping.store(true, std::memory_order_release);
+        const uint64_t one { 1 };
+        [[maybe_unused]] const auto bytes = ::write(wakeFd, &one, sizeof(one));
+    }
+
+
+    int listenTcp(const uint16_t port, const int backlog)
+    {
+        const int fd = tcpSocket();
+        constexpr int enable { 1 };
+        ::setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(enable));
+
+        sockaddr_in address {};
+        address.sin_family = AF_INET;
+        address.sin_port = htons(port);
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        if (::bind(fd, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) < 0 || ::listen(fd, backlog) < 0) {
+            const int error = errno;
+            ::close(fd);
+            throw std::system_error(error, std::system_category(), "listenTcp");
+        }
+        return fd;
+    }
+
+    int tcpSocket()
+    {
+        const int fd = ::socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+        if (fd < 0) {
+            throw std::system_error(errno, std::system_category(), "socket");
+        }
+        constexpr int enable { 1 };
+        ::setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &enable, sizeof(enable));
+        return fd;
+    }
+
+    sockaddr_in localAddress(const int fd)
+    {
+        sockaddr_in address {};
+        socklen_t length { sizeof(address) };
+        if (::getsockname(fd, reinterpret_cast<sockaddr*>(&address), &length) < 0) {
+            throw std::system_error(errno, std::system_category(), "getsockname");
+        }
+        return address;
+    }
+}
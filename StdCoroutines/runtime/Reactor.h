@@ -0,0 +1,178 @@
+/**============================================================================
+Name        : Reactor.h
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Edge-triggered epoll reactor with awaitable accept/connect/read/write
+============================================================================**/
+
+#ifndef CPPCOROUTINES_REACTOR_H
+#define CPPCOROUTINES_REACTOR_H
+
+#include <atomic>
+#include <chrono>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include <netinet/in.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+
+namespace StdCoroutines::Runtime
+{
+    class Reactor;
+
+    /**
+     * A pending socket operation. 'attempt' issues the syscall and returns false on EAGAIN;
+     * the reactor calls it again on the next readiness edge, so the awaiting coroutine is
+     * resumed only once there is a result - never to find EAGAIN and go back to sleep.
+    **/
+    struct IoOperation
+    {
+        bool (*attempt)(IoOperation*) { nullptr };
+        std::coroutine_handle<> continuation {};
+        ssize_t result { 0 };
+    };
+
+    /**
+     * Non-blocking socket registered once (EPOLLIN | EPOLLOUT | EPOLLET) for its whole lifetime.
+     * One reader and one writer may wait at a time. Results follow the kernel convention:
+     * >= 0 on success, -errno on failure. Not movable: epoll keeps its address.
+    **/
+    class Socket
+    {
+        friend class Reactor;
+
+        Reactor& reactor;
+        int fd { -1 };
+        IoOperation* reader { nullptr };
+        IoOperation* writer { nullptr };
+
+    public:
+
+        struct Awaiter : IoOperation
+        {
+            Socket& socket;
+            IoOperation* Socket::* slot;
+            void* buffer { nullptr };
+            size_t size { 0 };
+
+            Awaiter(Socket& socket, IoOperation* Socket::* slot, bool (*attempt)(IoOperation*),
+                    void* buffer, const size_t size) noexcept :
+                    IoOperation { attempt }, socket { socket }, slot { slot }, buffer { buffer }, size { size } {
+            }
+
+            [[nodiscard]]
+            bool await_ready() noexcept {
+                /** TRUE ==> await_resume() or in case FALSE ==> await_suspend() will be called **/
+                return attempt(this);
+            }
+
+            void await_suspend(const std::coroutine_handle<> hInputCoro) noexcept {
+                continuation = hInputCoro;
+                socket.*slot = this;
+            }
+
+            [[nodiscard]]
+            ssize_t await_resume() const noexcept {
+                return result;
+            }
+        };
+
+        /** Takes ownership of 'fd', switches it to non-blocking mode and registers it **/
+        Socket(Reactor& reactor, int fd);
+        ~Socket();
+
+        Socket(const Socket&) = delete;
+        Socket& operator=(const Socket&) = delete;
+
+        [[nodiscard]]
+        int descriptor() const noexcept {
+            return fd;
+        }
+
+        /** Result: the accepted descriptor (non-blocking, TCP_NODELAY) **/
+        [[nodiscard]]
+        Awaiter accept() noexcept;
+
+        /** Result: 0 once connected **/
+        [[nodiscard]]
+        Awaiter connect(const sockaddr_in& address) noexcept;
+
+        /** Result: 0 on the next read readiness edge; nothing is read (e.g. accept() keeps failing with EMFILE) **/
+        [[nodiscard]]
+        Awaiter readable() noexcept;
+
+        /** Result: bytes read, 0 on end of stream **/
+        [[nodiscard]]
+        Awaiter read(std::span<char> buffer) noexcept;
+
+        /** Result: bytes written, possibly fewer than requested **/
+        [[nodiscard]]
+        Awaiter write(std::span<const char> buffer) noexcept;
+
+        /** Writes all of 'buffer' unless an error occurs: result is buffer.size() or -errno **/
+        [[nodiscard]]
+        Awaiter writeAll(std::span<const char> buffer) noexcept;
+    };
+
+    /**
+     * Single threaded: run() waits on epoll and resumes coroutines on the calling thread, so
+     * sockets must be used from coroutines running on that thread. stop() may be called from anywhere.
+    **/
+    class Reactor
+    {
+        friend class Socket;
+
+        int epollFd { -1 };
+        int wakeFd { -1 };
+        std::atomic<bool> stopping { false };
+
+        std::vector<epoll_event> events;
+        size_t processed { 0 };
+        size_t received { 0 };
+
+        void add(Socket& socket);
+        void remove(Socket& socket) noexcept;
+
+        /** Retries the operation waiting in 'slot': its continuation if it has finished, otherwise null **/
+        static std::coroutine_handle<> complete(Socket& socket, IoOperation* Socket::* slot) noexcept;
+
+        /** One epoll_wait() (-1: no timeout) and everything it reported **/
+        void poll(int timeoutMs);
+
+    public:
+
+        explicit Reactor(size_t maxEvents = 256);
+        ~Reactor();
+
+        Reactor(const Reactor&) = delete;
+        Reactor& operator=(const Reactor&) = delete;
+
+        /** Processes readiness events until stop() **/
+        void run();
+
+        /** Processes readiness events for up to 'duration'. false - stop() has been called **/
+        bool runFor(std::chrono::milliseconds duration);
+
+        void stop() noexcept;
+    };
+
+    /** Listening IPv4 TCP socket on 127.0.0.1:'port' (0 - any free port). Throws std::system_error **/
+    [[nodiscard]]
+    int listenTcp(uint16_t port = 0, int backlog = SOMAXCONN);
+
+    /** Unconnected non-blocking IPv4 TCP socket. Throws std::system_error **/
+    [[nodiscard]]
+    int tcpSocket();
+
+    [[nodiscard]]
+    sockaddr_in localAddress(int fd);
+}
+
+#endif //CPPCOROUTINES_REACTOR_H
@@ -0,0 +1,69 @@
+/**============================================================================
+Name        : RoundRobin.cpp
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Single threaded cooperative round-robin scheduler for many coroutines
+============================================================================**/
+
+#include "RoundRobin.h"
+
+#include <limits>
+#include <utility>
+
+namespace StdCoroutines::Runtime
+{
+    RoundRobin::RoundRobin(const size_t prefetchDistance): prefetchDistance { prefetchDistance } {
+    }
+
+    RoundRobin::~RoundRobin()
+    {
+        /** Players still suspended in yield() are owned by us **/
+        for (const std::coroutine_handle<> handle: next) {
+            handle.destroy();
+        }
+    }
+
+    void RoundRobin::reserve(const size_t players)
+    {
+        current.reserve(players);
+        next.reserve(players);
+    }
+
+    void RoundRobin::spawn(const Player player)
+    {
+        next.push_back(player.coroHandle);
+    }
+
+    RoundRobin::Stats RoundRobin::runRounds(const uint64_t rounds)
+    {
+        Stats stats;
+        const auto start = std::chrono::steady_clock::now();
+        while (stats.rounds < rounds && !next.empty())
+        {
+            std::swap(current, next);
+            next.clear();
+
+            const size_t count = current.size();
+            std::coroutine_handle<>* const handles = current.data();
+            for (size_t idx = 0; idx < count; ++idx)
+            {
+                if (prefetchDistance > 0 && idx + prefetchDistance < count) {
+                    /** The frame starts with the resume function pointer, which resume() loads first **/
+                    __builtin_prefetch(handles[idx + prefetchDistance].address(), 0, 3);
+                }
+                handles[idx].resume();
+            }
+            stats.resumes += count;
+            ++stats.rounds;
+        }
+        stats.elapsed = std::chrono::steady_clock::now() - start;
+        return stats;
+    }
+
+    RoundRobin::Stats RoundRobin::run()
+    {
+        return runRounds(std::numeric_limits<uint64_t>::max());
+    }
+}
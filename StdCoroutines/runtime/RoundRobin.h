@@ -0,0 +1,120 @@
+/**============================================================================
+Name        : RoundRobin.h
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Single threaded cooperative round-robin scheduler for many coroutines
+============================================================================**/
+
+#ifndef CPPCOROUTINES_ROUNDROBIN_H
+#define CPPCOROUTINES_ROUNDROBIN_H
+
+#include <chrono>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <vector>
+
+#include "runtime/FrameStats.h"
+
+namespace StdCoroutines::Runtime
+{
+    /**
+     * Every coroutine that co_awaits yield() is appended to the next round. A round is a linear walk
+     * over a contiguous array of handles; the frame 'prefetchDistance' slots ahead is prefetched so
+     * that, with millions of players, resume() does not stall on a cold frame.
+    **/
+    class RoundRobin
+    {
+        std::vector<std::coroutine_handle<>> current;
+        std::vector<std::coroutine_handle<>> next;
+        size_t prefetchDistance;
+
+    public:
+
+        struct Stats
+        {
+            uint64_t rounds { 0 };
+            uint64_t resumes { 0 };
+            std::chrono::nanoseconds elapsed { 0 };
+
+            [[nodiscard]]
+            double nsPerResume() const noexcept {
+                return resumes ? static_cast<double>(elapsed.count()) / static_cast<double>(resumes) : 0.0;
+            }
+        };
+
+        struct YieldAwaiter
+        {
+            RoundRobin& scheduler;
+
+            [[nodiscard]]
+            bool await_ready() const noexcept {
+                /** TRUE ==> await_resume() or in case FALSE ==> await_suspend() will be called **/
+                return false;
+            }
+
+            void await_suspend(const std::coroutine_handle<> hInputCoro) const {
+                scheduler.next.push_back(hInputCoro);
+            }
+
+            void await_resume() const noexcept {
+            }
+        };
+
+        /** Fire-and-forget coroutine owned by the scheduler: starts suspended, frees its frame when done **/
+        struct Player
+        {
+            struct promise_type : FrameStats::Tracked<Player>
+            {
+                Player get_return_object() {
+                    return Player { std::coroutine_handle<promise_type>::from_promise(*this) };
+                }
+
+                std::suspend_always initial_suspend() noexcept {
+                    return {};
+                }
+
+                std::suspend_never final_suspend() noexcept {
+                    return {};
+                }
+
+                void return_void() noexcept {}
+                void unhandled_exception() { std::terminate(); }
+            };
+
+            std::coroutine_handle<promise_type> coroHandle;
+        };
+
+        explicit RoundRobin(size_t prefetchDistance = 8);
+        ~RoundRobin();
+
+        RoundRobin(const RoundRobin&) = delete;
+        RoundRobin& operator=(const RoundRobin&) = delete;
+
+        void reserve(size_t players);
+
+        /** Takes ownership of the (initially suspended) player, it first runs in the next round **/
+        void spawn(Player player);
+
+        [[nodiscard]]
+        YieldAwaiter yield() noexcept {
+            return YieldAwaiter { *this };
+        }
+
+        [[nodiscard]]
+        size_t runnable() const noexcept {
+            return next.size();
+        }
+
+        /** Runs at most 'rounds' rounds, stops earlier when nobody is runnable **/
+        Stats runRounds(uint64_t rounds);
+
+        /** Runs until every player has finished **/
+        Stats run();
+    };
+}
+
+#endif //CPPCOROUTINES_ROUNDROBIN_H
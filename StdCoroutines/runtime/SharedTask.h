@@ -0,0 +1,273 @@
+/**============================================================================
+Name        : SharedTask.h
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Lazy SharedTask<T>: any number of coroutines co_await it, the body runs once
+============================================================================**/
+
+#ifndef CPPCOROUTINES_SHAREDTASK_H
+#define CPPCOROUTINES_SHAREDTASK_H
+
+#include <atomic>
+#include <coroutine>
+#include <cstdint>
+#include <exception>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "runtime/FrameStats.h"
+
+namespace StdCoroutines::Runtime
+{
+    template<typename T = void>
+    class SharedTask;
+
+    namespace Details
+    {
+        /** Lives in the awaiting coroutine's frame, linked into the task's waiters' stack **/
+        struct SharedTaskWaiter
+        {
+            std::coroutine_handle<> continuation {};
+            SharedTaskWaiter* nextWaiter { nullptr };
+        };
+
+        /**
+         * 'state' is notStarted, completed, or the head of the waiters' stack while the body runs:
+         * the first waiter starts it, so that stack is never empty. References: one per SharedTask
+         * copy, plus one held by the running body so that a waiter dropping the last copy cannot
+         * free the frame under it.
+        **/
+        struct SharedTaskPromiseBase
+        {
+            static constexpr uintptr_t notStarted { 0 };
+            static constexpr uintptr_t completed { 1 };
+
+            std::atomic<uintptr_t> state { notStarted };
+            std::atomic<uint32_t> references { 1 };
+            std::exception_ptr exception {};
+
+            struct FinalAwaiter
+            {
+                [[nodiscard]]
+                bool await_ready() const noexcept {
+                    return false;
+                }
+
+                /** Resumes every waiter in turn, then drops the body's reference **/
+                template<typename Promise>
+                void await_suspend(const std::coroutine_handle<Promise> hCoro) const noexcept
+                {
+                    Promise& promise = hCoro.promise();
+                    const uintptr_t waiters = promise.state.exchange(completed, std::memory_order_acq_rel);
+                    auto* waiter = reinterpret_cast<SharedTaskWaiter*>(waiters);
+                    while (waiter) {
+                        SharedTaskWaiter* const next = waiter->nextWaiter;
+                        waiter->continuation.resume();
+                        waiter = next;
+                    }
+                    if (promise.release()) {
+                        hCoro.destroy();
+                    }
+                }
+
+                void await_resume() const noexcept {
+                }
+            };
+
+            std::suspend_always initial_suspend() const noexcept {
+                return {};
+            }
+
+            FinalAwaiter final_suspend() const noexcept {
+                return {};
+            }
+
+            void unhandled_exception() noexcept {
+                exception = std::current_exception();
+            }
+
+            [[nodiscard]]
+            bool isReady() const noexcept {
+                return completed == state.load(std::memory_order_acquire);
+            }
+
+            void acquire() noexcept {
+                references.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            /** true - that was the last reference **/
+            [[nodiscard]]
+            bool release() noexcept {
+                return 1 == references.fetch_sub(1, std::memory_order_acq_rel);
+            }
+
+            /** false - already completed, don't suspend. Otherwise the handle to continue with **/
+            [[nodiscard]]
+            std::coroutine_handle<> addWaiter(SharedTaskWaiter& waiter, const std::coroutine_handle<> body) noexcept
+            {
+                uintptr_t old = state.load(std::memory_order_acquire);
+                while (true)
+                {
+                    if (completed == old) {
+                        return {};
+                    }
+                    waiter.nextWaiter = reinterpret_cast<SharedTaskWaiter*>(old);
+                    if (state.compare_exchange_weak(old, reinterpret_cast<uintptr_t>(&waiter),
+                                                    std::memory_order_acq_rel, std::memory_order_acquire))
+                    {
+                        /** The first awaiter starts the body, with symmetric transfer **/
+                        if (notStarted == old) {
+                            acquire();
+                            return body;
+                        }
+                        return std::noop_coroutine();
+                    }
+                }
+            }
+
+            void rethrowIfFailed() const
+            {
+                if (exception) {
+                    std::rethrow_exception(exception);
+                }
+            }
+        };
+
+        template<typename T>
+        struct SharedTaskPromise : SharedTaskPromiseBase, FrameStats::Tracked<SharedTask<T>>
+        {
+            std::optional<T> value;
+
+            SharedTask<T> get_return_object() noexcept;
+
+            template<typename U>
+            void return_value(U&& result) {
+                value.emplace(std::forward<U>(result));
+            }
+
+            const T& result() const
+            {
+                rethrowIfFailed();
+                return *value;
+            }
+        };
+
+        template<>
+        struct SharedTaskPromise<void> : SharedTaskPromiseBase, FrameStats::Tracked<SharedTask<void>>
+        {
+            SharedTask<void> get_return_object() noexcept;
+
+            void return_void() const noexcept {
+            }
+
+            void result() const {
+                rethrowIfFailed();
+            }
+        };
+    }
+
+    /**
+     * Copyable handle to a lazily started coroutine. The first co_await starts the body; every
+     * awaiter - concurrent or late - gets the same result as const T& (or the same exception).
+     * Waiters are resumed one after the other on the thread that completes the body; later
+     * awaiters continue without suspending. The frame lives as long as any copy (or the body).
+    **/
+    template<typename T>
+    class [[nodiscard]] SharedTask
+    {
+    public:
+        using promise_type = Details::SharedTaskPromise<T>;
+        using value_type = T;
+
+    private:
+        std::coroutine_handle<promise_type> coroHandle {};
+
+        void release() noexcept
+        {
+            if (coroHandle && coroHandle.promise().release()) {
+                coroHandle.destroy();
+            }
+        }
+
+    public:
+
+        struct Awaiter : Details::SharedTaskWaiter
+        {
+            std::coroutine_handle<promise_type> coroHandle;
+
+            /** Same as Task: awaiting an empty SharedTask throws std::logic_error **/
+            [[nodiscard]]
+            bool await_ready() const
+            {
+                /** TRUE ==> await_resume() or in case FALSE ==> await_suspend() will be called **/
+                if (!coroHandle) {
+                    throw std::logic_error("SharedTask: co_await on an empty task");
+                }
+                return coroHandle.promise().isReady();
+            }
+
+            std::coroutine_handle<> await_suspend(const std::coroutine_handle<> hInputCoro) noexcept
+            {
+                continuation = hInputCoro;
+                const std::coroutine_handle<> next = coroHandle.promise().addWaiter(*this, coroHandle);
+                return next ? next : hInputCoro;
+            }
+
+            decltype(auto) await_resume() const {
+                return coroHandle.promise().result();
+            }
+        };
+
+        SharedTask() noexcept = default;
+
+        explicit SharedTask(const std::coroutine_handle<promise_type> handle) noexcept : coroHandle { handle } {
+        }
+
+        SharedTask(const SharedTask& other) noexcept : coroHandle { other.coroHandle }
+        {
+            if (coroHandle) {
+                coroHandle.promise().acquire();
+            }
+        }
+
+        SharedTask(SharedTask&& other) noexcept : coroHandle { std::exchange(other.coroHandle, {}) } {
+        }
+
+        SharedTask& operator=(SharedTask other) noexcept
+        {
+            std::swap(coroHandle, other.coroHandle);
+            return *this;
+        }
+
+        ~SharedTask() {
+            release();
+        }
+
+        [[nodiscard]]
+        bool isReady() const noexcept {
+            return !coroHandle || coroHandle.promise().isReady();
+        }
+
+        Awaiter operator co_await() const noexcept {
+            return Awaiter { {}, coroHandle };
+        }
+    };
+
+    namespace Details
+    {
+        template<typename T>
+        SharedTask<T> SharedTaskPromise<T>::get_return_object() noexcept {
+            return SharedTask<T> { std::coroutine_handle<SharedTaskPromise>::from_promise(*this) };
+        }
+
+        inline SharedTask<void> SharedTaskPromise<void>::get_return_object() noexcept {
+            return SharedTask<void> { std::coroutine_handle<SharedTaskPromise>::from_promise(*this) };
+        }
+    }
+}
+
+#endif //CPPCOROUTINES_SHAREDTASK_H
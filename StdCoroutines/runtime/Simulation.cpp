@@ -0,0 +1,192 @@
+/**============================================================================
+Name        : Simulation.cpp
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Discrete-event simulation kernel with virtual time
+============================================================================**/
+
+#include "Simulation.h"
+
+#include <barrier>
+#include <limits>
+#include <stdexcept>
+#include <thread>
+
+namespace
+{
+    constexpr int64_t never = std::numeric_limits<int64_t>::max();
+
+    /** First tick past 'until', saturating **/
+    int64_t limitAfter(const StdCoroutines::Runtime::Simulation::Duration until) noexcept {
+        return until.count() == never ? never : until.count() + 1;
+    }
+}
+
+namespace StdCoroutines::Runtime::Simulation
+{
+    Simulator::~Simulator()
+    {
+        /** Processes still waiting for their virtual time are owned by us **/
+        for (const Entry& entry: events) {
+            entry.handle.destroy();
+        }
+    }
+
+    void Simulator::reserve(const size_t pendingEvents)
+    {
+        events.reserve(pendingEvents);
+    }
+
+    void Simulator::spawn(const Process process, const Duration delay)
+    {
+        schedule(process.coroHandle, nowTicks + delay.count());
+    }
+
+    Simulator::MigrateAwaiter Simulator::migrate(Simulator& target, const Duration delay)
+    {
+        if (parallel && delay.count() < parallel->lookaheadTicks) {
+            throw std::invalid_argument("Simulator::migrate(): delay is shorter than the lookahead");
+        }
+        return MigrateAwaiter { *this, target, delay };
+    }
+
+    void Simulator::post(Simulator& target, const std::coroutine_handle<> handle, const int64_t time)
+    {
+        if (!parallel || &target == this) {
+            target.schedule(handle, time);
+            return;
+        }
+        const size_t partitionsCount = parallel->partitions.size();
+        parallel->outboxes[partitionIndex * partitionsCount + target.partitionIndex].entries.push_back(
+            Entry { time, 0, handle });
+    }
+
+    int64_t Simulator::nextTime() const noexcept
+    {
+        return events.empty() ? never : events.front().time;
+    }
+
+    uint64_t Simulator::runBefore(const int64_t limit)
+    {
+        uint64_t processed { 0 };
+        while (!events.empty() && events.front().time < limit)
+        {
+            std::pop_heap(events.begin(), events.end(), Later {});
+            const Entry entry = events.back();
+            events.pop_back();
+
+            nowTicks = entry.time;
+            entry.handle.resume();
+            ++processed;
+        }
+        return processed;
+    }
+
+    Stats Simulator::run(const Duration until)
+    {
+        Stats stats;
+        const auto start = std::chrono::steady_clock::now();
+        stats.events = runBefore(limitAfter(until));
+        stats.wallTime = std::chrono::steady_clock::now() - start;
+        stats.virtualTime = now();
+        stats.windows = 1;
+        return stats;
+    }
+
+
+    ParallelSimulation::ParallelSimulation(const size_t partitionsCount, const Duration lookahead):
+        partitions(partitionsCount), lookaheadTicks { lookahead.count() }, outboxes(partitionsCount * partitionsCount)
+    {
+        if (0 == partitionsCount || lookaheadTicks <= 0) {
+            throw std::invalid_argument("ParallelSimulation: need at least one partition and a positive lookahead");
+        }
+        for (size_t idx = 0; idx < partitionsCount; ++idx) {
+            partitions[idx].parallel = this;
+            partitions[idx].partitionIndex = idx;
+        }
+    }
+
+    ParallelSimulation::~ParallelSimulation()
+    {
+        /** Migrations not yet delivered (a partition was run on its own) own their processes as well **/
+        for (const Mailbox& mailbox: outboxes) {
+            for (const Simulator::Entry& entry: mailbox.entries) {
+                entry.handle.destroy();
+            }
+        }
+    }
+
+    Stats ParallelSimulation::run(const Duration until)
+    {
+        const size_t count = partitions.size();
+        const int64_t limit = limitAfter(until);
+
+        std::vector<int64_t> nextTimes(count, never);
+        std::vector<uint64_t> processed(count, 0);
+        int64_t windowEnd { 0 };
+        bool done { false };
+        uint64_t windows { 0 };
+
+        /** Runs once per window, after every partition has published its earliest event **/
+        auto nextWindow = [&]() noexcept
+        {
+            const int64_t earliest = *std::min_element(nextTimes.begin(), nextTimes.end());
+            if (never == earliest || earliest >= limit) {
+                done = true;
+                return;
+            }
+            windowEnd = std::min(limit, earliest > never - lookaheadTicks ? never : earliest + lookaheadTicks);
+            ++windows;
+        };
+
+        std::barrier published { static_cast<std::ptrdiff_t>(count), nextWindow };
+        std::barrier exchanged { static_cast<std::ptrdiff_t>(count) };
+
+        auto worker = [&](const size_t idx)
+        {
+            Simulator& self = partitions[idx];
+            while (true)
+            {
+                /** Sources write our inboxes only inside a window, i.e. not before 'published' **/
+                for (size_t source = 0; source < count; ++source)
+                {
+                    std::vector<Simulator::Entry>& inbox = outboxes[source * count + idx].entries;
+                    for (const Simulator::Entry& entry: inbox) {
+                        self.schedule(entry.handle, entry.time);
+                    }
+                    inbox.clear();
+                }
+                nextTimes[idx] = self.nextTime();
+
+                published.arrive_and_wait();
+                if (done) {
+                    break;
+                }
+
+                processed[idx] += self.runBefore(windowEnd);
+                exchanged.arrive_and_wait();
+            }
+        };
+
+        Stats stats;
+        const auto start = std::chrono::steady_clock::now();
+        {
+            std::vector<std::jthread> threads;
+            threads.reserve(count - 1);
+            for (size_t idx = 1; idx < count; ++idx) {
+                threads.emplace_back(worker, idx);
+            }
+            worker(0);
+        }
+        stats.wallTime = std::chrono::steady_clock::now() - start;
+
+        for (size_t idx = 0; idx < count; ++idx) {
+            stats.events += processed[idx];
+            stats.virtualTime = std::max(stats.virtualTime, partitions[idx].now());
+        }
+        stats.windows = windows;
+        return stats;
+    }
+}
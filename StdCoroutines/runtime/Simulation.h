@@ -0,0 +1,240 @@
+/**============================================================================
+Name        : Simulation.h
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Discrete-event simulation kernel with virtual time
+============================================================================**/
+
+#ifndef CPPCOROUTINES_SIMULATION_H
+#define CPPCOROUTINES_SIMULATION_H
+
+#include <algorithm>
+#include <chrono>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <vector>
+
+#include "runtime/FrameStats.h"
+
+namespace StdCoroutines::Runtime::Simulation
+{
+    /** Virtual time: never related to the wall clock **/
+    using Duration = std::chrono::nanoseconds;
+
+    struct Stats
+    {
+        uint64_t events { 0 };
+        uint64_t windows { 0 };
+        Duration virtualTime { 0 };
+        std::chrono::nanoseconds wallTime { 0 };
+
+        [[nodiscard]]
+        double eventsPerSecond() const noexcept {
+            return wallTime.count() ? static_cast<double>(events) * 1e9 / static_cast<double>(wallTime.count()) : 0.0;
+        }
+    };
+
+    /** Fire-and-forget simulated process: starts suspended, frees its frame when done **/
+    struct Process
+    {
+        struct promise_type : FrameStats::Tracked<Process>
+        {
+            Process get_return_object() {
+                return Process { std::coroutine_handle<promise_type>::from_promise(*this) };
+            }
+
+            std::suspend_always initial_suspend() noexcept {
+                return {};
+            }
+
+            std::suspend_never final_suspend() noexcept {
+                return {};
+            }
+
+            void return_void() noexcept {}
+            void unhandled_exception() { std::terminate(); }
+        };
+
+        std::coroutine_handle<promise_type> coroHandle;
+    };
+
+    class ParallelSimulation;
+
+    /**
+     * One event list: a binary heap of (time, sequence, coroutine) ordered by virtual time,
+     * the sequence number keeps events at the same instant in FIFO order. co_await delay(d)
+     * is a heap push, running an event is a heap pop and a resume - no threads, no sleeping.
+    **/
+    class Simulator
+    {
+        friend class ParallelSimulation;
+
+        struct Entry
+        {
+            int64_t time;
+            uint64_t sequence;
+            std::coroutine_handle<> handle;
+        };
+
+        struct Later
+        {
+            bool operator()(const Entry& lhs, const Entry& rhs) const noexcept {
+                return lhs.time != rhs.time ? lhs.time > rhs.time : lhs.sequence > rhs.sequence;
+            }
+        };
+
+        std::vector<Entry> events;
+        int64_t nowTicks { 0 };
+        uint64_t sequence { 0 };
+
+        /** Set only when the simulator is a partition of a ParallelSimulation **/
+        ParallelSimulation* parallel { nullptr };
+        size_t partitionIndex { 0 };
+
+        void post(Simulator& target, std::coroutine_handle<> handle, int64_t time);
+
+        /** Processes events with time < limit, returns the number of resumes **/
+        uint64_t runBefore(int64_t limit);
+
+        [[nodiscard]]
+        int64_t nextTime() const noexcept;
+
+    public:
+
+        struct DelayAwaiter
+        {
+            Simulator& simulator;
+            Duration delay;
+
+            [[nodiscard]]
+            bool await_ready() const noexcept {
+                /** TRUE ==> await_resume() or in case FALSE ==> await_suspend() will be called **/
+                return false;
+            }
+
+            void await_suspend(const std::coroutine_handle<> hInputCoro) const {
+                simulator.schedule(hInputCoro, simulator.nowTicks + delay.count());
+            }
+
+            void await_resume() const noexcept {
+            }
+        };
+
+        struct MigrateAwaiter
+        {
+            Simulator& source;
+            Simulator& target;
+            Duration delay;
+
+            [[nodiscard]]
+            bool await_ready() const noexcept {
+                return false;
+            }
+
+            void await_suspend(const std::coroutine_handle<> hInputCoro) const {
+                source.post(target, hInputCoro, source.nowTicks + delay.count());
+            }
+
+            /** The simulator the process lives on from now on **/
+            [[nodiscard]]
+            Simulator& await_resume() const noexcept {
+                return target;
+            }
+        };
+
+        Simulator() = default;
+        ~Simulator();
+
+        Simulator(const Simulator&) = delete;
+        Simulator& operator=(const Simulator&) = delete;
+
+        void reserve(size_t pendingEvents);
+
+        [[nodiscard]]
+        Duration now() const noexcept {
+            return Duration { nowTicks };
+        }
+
+        [[nodiscard]]
+        size_t pending() const noexcept {
+            return events.size();
+        }
+
+        /** Takes ownership of the process, it starts after 'delay' of virtual time **/
+        void spawn(Process process, Duration delay = Duration { 0 });
+
+        [[nodiscard]]
+        DelayAwaiter delay(const Duration delay) noexcept {
+            return DelayAwaiter { *this, delay };
+        }
+
+        /**
+         * Continue on another simulator after 'delay'. In a ParallelSimulation the delay must be
+         * at least the lookahead - that is what lets partitions run ahead of each other safely.
+        **/
+        [[nodiscard]]
+        MigrateAwaiter migrate(Simulator& target, Duration delay);
+
+        /** Runs every event up to and including virtual time 'until' **/
+        Stats run(Duration until = Duration::max());
+
+        void schedule(const std::coroutine_handle<> handle, const int64_t time)
+        {
+            events.push_back(Entry { time, sequence++, handle });
+            std::push_heap(events.begin(), events.end(), Later {});
+        }
+    };
+
+    /**
+     * Conservative synchronous-window parallel mode. Every partition runs on its own thread;
+     * processes interact across partitions only through migrate() with delay >= lookahead.
+     * Each window [T, T + lookahead), T being the global earliest pending event, is therefore
+     * safe to process independently; migrations are exchanged at the window barrier.
+    **/
+    class ParallelSimulation
+    {
+        friend class Simulator;
+
+        struct Mailbox
+        {
+            std::vector<Simulator::Entry> entries;
+        };
+
+        std::vector<Simulator> partitions;
+        int64_t lookaheadTicks;
+
+        /** outboxes[source * partitionsCount + target], written by the source during a window **/
+        std::vector<Mailbox> outboxes;
+
+    public:
+
+        ParallelSimulation(size_t partitionsCount, Duration lookahead);
+        ~ParallelSimulation();
+
+        ParallelSimulation(const ParallelSimulation&) = delete;
+        ParallelSimulation& operator=(const ParallelSimulation&) = delete;
+
+        [[nodiscard]]
+        size_t size() const noexcept {
+            return partitions.size();
+        }
+
+        [[nodiscard]]
+        Simulator& partition(const size_t idx) noexcept {
+            return partitions[idx];
+        }
+
+        [[nodiscard]]
+        Duration lookahead() const noexcept {
+            return Duration { lookaheadTicks };
+        }
+
+        Stats run(Duration until = Duration::max());
+    };
+}
+
+#endif //CPPCOROUTINES_SIMULATION_H
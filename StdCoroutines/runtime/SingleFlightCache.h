@@ -0,0 +1,130 @@
+/**============================================================================
+Name        : SingleFlightCache.h
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Loader cache: concurrent requests for one key share a single load
+============================================================================**/
+
+#ifndef CPPCOROUTINES_SINGLEFLIGHTCACHE_H
+#define CPPCOROUTINES_SINGLEFLIGHTCACHE_H
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+#include "runtime/SharedTask.h"
+#include "runtime/Task.h"
+
+namespace StdCoroutines::Runtime
+{
+    /**
+     * get(key) returns the SharedTask loading 'key': the first request creates it, everybody
+     * asking while it runs awaits the same task, and once it has finished the value stays
+     * cached until invalidate(). A failed load is forgotten, so the next request retries.
+     * const Value& from co_await get(key) stays valid while the entry is cached.
+    **/
+    template<typename Key, typename Value, typename Hash = std::hash<Key>>
+    class SingleFlightCache
+    {
+    public:
+
+        using Loader = std::function<Task<Value>(const Key&)>;
+
+        struct Stats
+        {
+            uint64_t requests { 0 };
+            uint64_t loads { 0 };
+        };
+
+    private:
+
+        struct Entry
+        {
+            SharedTask<Value> task;
+            uint64_t generation { 0 };
+        };
+
+        Loader loader;
+        std::mutex mutex;
+        std::unordered_map<Key, Entry, Hash> entries;
+        uint64_t generations { 0 };
+        std::atomic<uint64_t> requests { 0 };
+        std::atomic<uint64_t> loads { 0 };
+
+        SharedTask<Value> load(const Key key, const uint64_t generation)
+        {
+            loads.fetch_add(1, std::memory_order_relaxed);
+            try {
+                co_return co_await loader(key);
+            } catch (...) {
+                forget(key, generation);
+                throw;
+            }
+        }
+
+        /** Only the entry of this very load: after invalidate() the key may already hold a newer one **/
+        void forget(const Key& key, const uint64_t generation)
+        {
+            SharedTask<Value> dropped;
+            std::lock_guard lock { mutex };
+            if (const auto iter = entries.find(key); entries.end() != iter && generation == iter->second.generation) {
+                dropped = std::move(iter->second.task);
+                entries.erase(iter);
+            }
+        }
+
+    public:
+
+        explicit SingleFlightCache(Loader loader): loader { std::move(loader) } {
+        }
+
+        SingleFlightCache(const SingleFlightCache&) = delete;
+        SingleFlightCache& operator=(const SingleFlightCache&) = delete;
+
+        /** const Value& value = co_await cache.get(key); **/
+        [[nodiscard]]
+        SharedTask<Value> get(const Key& key)
+        {
+            requests.fetch_add(1, std::memory_order_relaxed);
+            std::lock_guard lock { mutex };
+            if (const auto iter = entries.find(key); entries.end() != iter) {
+                return iter->second.task;
+            }
+            /** Lazy: the load starts with the first co_await, outside the lock **/
+            const uint64_t generation = ++generations;
+            return entries.emplace(key, Entry { load(key, generation), generation }).first->second.task;
+        }
+
+        void invalidate(const Key& key)
+        {
+            /** Released outside the lock: it may be the last reference to the frame **/
+            SharedTask<Value> dropped;
+            {
+                std::lock_guard lock { mutex };
+                if (const auto iter = entries.find(key); entries.end() != iter) {
+                    dropped = std::move(iter->second.task);
+                    entries.erase(iter);
+                }
+            }
+        }
+
+        [[nodiscard]]
+        size_t size()
+        {
+            std::lock_guard lock { mutex };
+            return entries.size();
+        }
+
+        [[nodiscard]]
+        Stats stats() const noexcept {
+            return Stats { requests.load(std::memory_order_relaxed), loads.load(std::memory_order_relaxed) };
+        }
+    };
+}
+
+#endif //CPPCOROUTINES_SINGLEFLIGHTCACHE_H
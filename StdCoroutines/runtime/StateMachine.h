@@ -0,0 +1,303 @@
+/**============================================================================
+Name        : StateMachine.h
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Compile-time validated transition tables + flat arrays of coroutine driven machines
+============================================================================**/
+
+#ifndef CPPCOROUTINES_STATEMACHINE_H
+#define CPPCOROUTINES_STATEMACHINE_H
+
+#include <array>
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <initializer_list>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "runtime/FrameStats.h"
+
+namespace StdCoroutines::Runtime::StateMachine
+{
+    /** States and events are plain enums closed by a 'Count' enumerator **/
+    template<typename Enum>
+    concept CountedEnum = std::is_enum_v<Enum> && requires { Enum::Count; };
+
+    template<CountedEnum Enum>
+    constexpr size_t index(const Enum value) noexcept {
+        return static_cast<size_t>(value);
+    }
+
+    template<CountedEnum State, CountedEnum Event>
+    struct Transition
+    {
+        State from;
+        Event event;
+        State to;
+    };
+
+    /**
+     * Dense [state x event] -> state lookup table. The constructor is consteval: a duplicated
+     * (state, event) pair, an out of range enumerator or a state unreachable from 'initial'
+     * makes the table definition ill-formed, so a broken machine does not compile.
+    **/
+    template<CountedEnum State_, CountedEnum Event_>
+    struct TransitionTable
+    {
+        using State = State_;
+        using Event = Event_;
+
+        static constexpr size_t statesCount = index(State::Count);
+        static constexpr size_t eventsCount = index(Event::Count);
+
+        /** 'No transition' marker **/
+        static constexpr State invalid = State::Count;
+
+        State initial;
+        std::array<State, statesCount * eventsCount> next {};
+
+        consteval TransitionTable(const State initialState,
+                                  const std::initializer_list<Transition<State, Event>> transitions): initial { initialState }
+        {
+            if (index(initial) >= statesCount)
+                throw std::logic_error("TransitionTable: initial state is out of range");
+
+            next.fill(invalid);
+            for (const Transition<State, Event>& transition: transitions)
+            {
+                if (index(transition.from) >= statesCount || index(transition.to) >= statesCount ||
+                    index(transition.event) >= eventsCount)
+                    throw std::logic_error("TransitionTable: enumerator out of range");
+
+                State& target = next[index(transition.from) * eventsCount + index(transition.event)];
+                if (invalid != target)
+                    throw std::logic_error("TransitionTable: duplicated (state, event) transition");
+                target = transition.to;
+            }
+
+            std::array<bool, statesCount> reachable {};
+            std::array<State, statesCount> pending {};
+            size_t pendingCount = 0;
+            reachable[index(initial)] = true;
+            pending[pendingCount++] = initial;
+            while (pendingCount > 0)
+            {
+                const State state = pending[--pendingCount];
+                for (size_t event = 0; event < eventsCount; ++event)
+                {
+                    const State to = next[index(state) * eventsCount + event];
+                    if (invalid != to && !reachable[index(to)]) {
+                        reachable[index(to)] = true;
+                        pending[pendingCount++] = to;
+                    }
+                }
+            }
+            for (const bool isReachable: reachable) {
+                if (!isReachable)
+                    throw std::logic_error("TransitionTable: state is unreachable from the initial state");
+            }
+        }
+
+        /** O(1): a single indexed load. Returns 'invalid' if the event is not accepted in 'from' **/
+        [[nodiscard]]
+        constexpr State target(const State from, const Event event) const noexcept {
+            return next[index(from) * eventsCount + index(event)];
+        }
+
+        [[nodiscard]]
+        constexpr bool accepts(const State from, const Event event) const noexcept {
+            return invalid != target(from, event);
+        }
+    };
+
+    template<typename Table>
+    struct Step
+    {
+        size_t machine;
+        typename Table::State from;
+        typename Table::Event event;
+        typename Table::State to;
+    };
+
+    template<const auto& Table>
+    class Machines;
+
+    /**
+     * Behaviour attached to one machine: the body loops on 'co_await machines.transitions(idx)'
+     * and runs whatever the new state requires. It never resumes itself - only dispatch() does.
+     * Destroying it takes it out of the machine it waits on; the Machines must outlive it.
+    **/
+    template<const auto& Table>
+    struct Behaviour
+    {
+        struct promise_type : FrameStats::Tracked<Behaviour>
+        {
+            /** The Machines slot this coroutine was last parked in (possibly taken by dispatch() since) **/
+            std::coroutine_handle<>* parkedIn { nullptr };
+
+            Behaviour get_return_object() {
+                return Behaviour { std::coroutine_handle<promise_type>::from_promise(*this) };
+            }
+
+            std::suspend_never initial_suspend() noexcept {
+                return {};
+            }
+
+            std::suspend_always final_suspend() noexcept {
+                return {};
+            }
+
+            void return_void() noexcept {}
+            void unhandled_exception() { std::terminate(); }
+        };
+
+        std::coroutine_handle<promise_type> coroHandle {};
+
+        explicit Behaviour(const std::coroutine_handle<promise_type> handle) : coroHandle { handle } {
+        }
+
+        Behaviour(Behaviour&& other) noexcept : coroHandle { std::exchange(other.coroHandle, {}) } {
+        }
+
+        Behaviour(const Behaviour&) = delete;
+        Behaviour& operator=(const Behaviour&) = delete;
+
+        ~Behaviour()
+        {
+            if (coroHandle)
+            {
+                if (std::coroutine_handle<>* const slot = coroHandle.promise().parkedIn; slot && *slot == coroHandle) {
+                    *slot = {};
+                }
+                coroHandle.destroy();
+            }
+        }
+    };
+
+    /**
+     * N independent machines sharing one table. The states live in one flat array (one byte per
+     * machine for a uint8_t based enum) so a tick over thousands of machines is a linear scan.
+     * Behaviour coroutines are optional: without them dispatch() is a table lookup and a store.
+    **/
+    template<const auto& Table>
+    class Machines
+    {
+    public:
+        using TableType = std::remove_cvref_t<decltype(Table)>;
+        using State = typename TableType::State;
+        using Event = typename TableType::Event;
+
+    private:
+        std::vector<State> states;
+        std::vector<std::coroutine_handle<>> behaviours;
+
+        /** Valid only while a behaviour is being resumed from dispatch() **/
+        Step<TableType> current {};
+
+    public:
+
+        struct TransitionAwaiter
+        {
+            Machines& machines;
+            size_t machine;
+
+            [[nodiscard]]
+            bool await_ready() const noexcept {
+                /** TRUE ==> await_resume() or in case FALSE ==> await_suspend() will be called **/
+                return false;
+            }
+
+            template<typename Promise>
+            void await_suspend(const std::coroutine_handle<Promise> hInputCoro) const noexcept
+            {
+                machines.behaviours[machine] = hInputCoro;
+                if constexpr (requires { hInputCoro.promise().parkedIn; }) {
+                    hInputCoro.promise().parkedIn = &machines.behaviours[machine];
+                }
+            }
+
+            [[nodiscard]]
+            Step<TableType> await_resume() const noexcept {
+                return machines.current;
+            }
+        };
+
+        explicit Machines(const size_t count): states(count, Table.initial) {
+        }
+
+        Machines(const Machines&) = delete;
+        Machines& operator=(const Machines&) = delete;
+
+        [[nodiscard]]
+        size_t size() const noexcept {
+            return states.size();
+        }
+
+        [[nodiscard]]
+        State state(const size_t machine) const noexcept {
+            return states[machine];
+        }
+
+        [[nodiscard]]
+        std::span<const State> view() const noexcept {
+            return states;
+        }
+
+        /** co_await inside a Behaviour: suspends until the next accepted event of 'machine' **/
+        [[nodiscard]]
+        TransitionAwaiter transitions(const size_t machine)
+        {
+            if (behaviours.empty()) {
+                behaviours.resize(states.size());
+            }
+            return TransitionAwaiter { *this, machine };
+        }
+
+        /** O(1), no allocation. Returns false (state unchanged) if the event is not accepted **/
+        bool dispatch(const size_t machine, const Event event)
+        {
+            const State from = states[machine];
+            const State to = Table.target(from, event);
+            if (TableType::invalid == to) [[unlikely]] {
+                return false;
+            }
+            states[machine] = to;
+
+            if (!behaviours.empty()) {
+                if (const std::coroutine_handle<> behaviour = std::exchange(behaviours[machine], {})) {
+                    current = Step<TableType> { machine, from, event, to };
+                    behaviour.resume();
+                }
+            }
+            return true;
+        }
+
+        /** One tick: events[i] goes to machine i. Returns the number of accepted events **/
+        size_t step(const std::span<const Event> events)
+        {
+            size_t accepted = 0;
+            for (size_t machine = 0; machine < events.size() && machine < states.size(); ++machine) {
+                accepted += dispatch(machine, events[machine]) ? 1 : 0;
+            }
+            return accepted;
+        }
+
+        /** One tick: the same event to every machine. Returns the number of accepted events **/
+        size_t broadcast(const Event event)
+        {
+            size_t accepted = 0;
+            for (size_t machine = 0; machine < states.size(); ++machine) {
+                accepted += dispatch(machine, event) ? 1 : 0;
+            }
+            return accepted;
+        }
+    };
+}
+
+#endif //CPPCOROUTINES_STATEMACHINE_H
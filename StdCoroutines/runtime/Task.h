@@ -0,0 +1,419 @@
+/**============================================================================
+Name        : Task.h
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Lazy Task<T> with symmetric transfer + syncWait() to block on it
+============================================================================**/
+
+#ifndef CPPCOROUTINES_TASK_H
+#define CPPCOROUTINES_TASK_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <coroutine>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "runtime/FrameStats.h"
+
+namespace StdCoroutines::Runtime
+{
+    template<typename T = void>
+    class Task;
+
+    /** Scheduling hint carried by the promise, read by priority aware executors (PriorityScheduler) **/
+    enum class Priority : uint8_t
+    {
+        High,
+        Normal,
+        Low
+    };
+
+    namespace Details
+    {
+        struct TaskPromiseBase
+        {
+            std::coroutine_handle<> continuation {};
+            std::exception_ptr exception {};
+            Priority priority { Priority::Normal };
+
+            /** For deadline aware executors (DeadlineScheduler): time_point::max() - no deadline **/
+            std::chrono::steady_clock::time_point deadline { std::chrono::steady_clock::time_point::max() };
+
+            struct FinalAwaiter
+            {
+                [[nodiscard]]
+                bool await_ready() const noexcept {
+                    return false;
+                }
+
+                /** Symmetric transfer back to whoever awaited us - no stack growth on long await chains **/
+                template<typename Promise>
+                std::coroutine_handle<> await_suspend(const std::coroutine_handle<Promise> hCoro) const noexcept
+                {
+                    if (const std::coroutine_handle<> continuation = hCoro.promise().continuation)
+                        return continuation;
+                    return std::noop_coroutine();
+                }
+
+                void await_resume() const noexcept {
+                }
+            };
+
+            std::suspend_always initial_suspend() const noexcept {
+                return {};
+            }
+
+            FinalAwaiter final_suspend() const noexcept {
+                return {};
+            }
+
+            void unhandled_exception() noexcept {
+                exception = std::current_exception();
+            }
+
+            void rethrowIfFailed() const
+            {
+                if (exception) {
+                    std::rethrow_exception(exception);
+                }
+            }
+        };
+
+        template<typename T>
+        struct TaskPromise : TaskPromiseBase, FrameStats::Tracked<Task<T>>
+        {
+            std::optional<T> value;
+
+            Task<T> get_return_object() noexcept;
+
+            template<typename U>
+            void return_value(U&& result) {
+                value.emplace(std::forward<U>(result));
+            }
+
+            T result()
+            {
+                rethrowIfFailed();
+                return std::move(*value);
+            }
+        };
+
+        template<>
+        struct TaskPromise<void> : TaskPromiseBase, FrameStats::Tracked<Task<void>>
+        {
+            Task<void> get_return_object() noexcept;
+
+            void return_void() const noexcept {
+            }
+
+            void result() const {
+                rethrowIfFailed();
+            }
+        };
+    }
+
+    /** Lazy: the body starts when the task is co_awaited (or handed to syncWait()) **/
+    template<typename T>
+    class [[nodiscard]] Task
+    {
+    public:
+        using promise_type = Details::TaskPromise<T>;
+        using value_type = T;
+
+    private:
+        std::coroutine_handle<promise_type> coroHandle {};
+
+    public:
+
+        explicit Task(const std::coroutine_handle<promise_type> handle) noexcept : coroHandle { handle } {
+        }
+
+        Task(Task&& other) noexcept : coroHandle { std::exchange(other.coroHandle, {}) } {
+        }
+
+        Task& operator=(Task&& other) noexcept
+        {
+            if (this != &other) {
+                if (coroHandle)
+                    coroHandle.destroy();
+                coroHandle = std::exchange(other.coroHandle, {});
+            }
+            return *this;
+        }
+
+        Task(const Task&) = delete;
+        Task& operator=(const Task&) = delete;
+
+        ~Task()
+        {
+            if (coroHandle) {
+                coroHandle.destroy();
+            }
+        }
+
+        [[nodiscard]]
+        std::coroutine_handle<promise_type> handle() const noexcept {
+            return coroHandle;
+        }
+
+        /** An empty (moved-from) Task has nothing to await: throws std::logic_error **/
+        [[nodiscard]]
+        bool await_ready() const
+        {
+            /** TRUE ==> await_resume() or in case FALSE ==> await_suspend() will be called **/
+            if (!coroHandle) {
+                throw std::logic_error("Task: co_await on an empty task");
+            }
+            return coroHandle.done();
+        }
+
+        std::coroutine_handle<> await_suspend(const std::coroutine_handle<> caller) noexcept
+        {
+            coroHandle.promise().continuation = caller;
+            return coroHandle;
+        }
+
+        decltype(auto) await_resume() {
+            return coroHandle.promise().result();
+        }
+    };
+
+    namespace Details
+    {
+        template<typename T>
+        Task<T> TaskPromise<T>::get_return_object() noexcept {
+            return Task<T> { std::coroutine_handle<TaskPromise>::from_promise(*this) };
+        }
+
+        inline Task<void> TaskPromise<void>::get_return_object() noexcept {
+            return Task<void> { std::coroutine_handle<TaskPromise>::from_promise(*this) };
+        }
+
+        /** The awaiter behind 'awaitable' and the (decayed) type co_await on it produces **/
+        template<typename Awaitable>
+        decltype(auto) awaiterOf(Awaitable&& awaitable)
+        {
+            if constexpr (requires { std::forward<Awaitable>(awaitable).operator co_await(); })
+                return std::forward<Awaitable>(awaitable).operator co_await();
+            else
+                return std::forward<Awaitable>(awaitable);
+        }
+
+        template<typename Awaitable>
+        using AwaitResult = std::remove_cvref_t<decltype(awaiterOf(std::declval<Awaitable&>()).await_resume())>;
+
+        /** Driver for syncWait(): signals the waiting thread from its final suspend **/
+        struct SyncWaitDriver
+        {
+            struct Signal
+            {
+                std::mutex mutex;
+                std::condition_variable finished;
+                bool done { false };
+            };
+
+            struct promise_type
+            {
+                Signal* signal { nullptr };
+
+                SyncWaitDriver get_return_object() noexcept {
+                    return SyncWaitDriver { std::coroutine_handle<promise_type>::from_promise(*this) };
+                }
+
+                std::suspend_always initial_suspend() const noexcept {
+                    return {};
+                }
+
+                auto final_suspend() const noexcept
+                {
+                    struct Notify
+                    {
+                        [[nodiscard]]
+                        bool await_ready() const noexcept {
+                            return false;
+                        }
+
+                        void await_suspend(const std::coroutine_handle<promise_type> hCoro) const noexcept
+                        {
+                            /** Notify under the lock: the waiter cannot destroy 'signal' before we are done with it **/
+                            Signal& signal = *hCoro.promise().signal;
+                            std::lock_guard lock { signal.mutex };
+                            signal.done = true;
+                            signal.finished.notify_one();
+                        }
+
+                        void await_resume() const noexcept {
+                        }
+                    };
+                    return Notify {};
+                }
+
+                void return_void() const noexcept {}
+                void unhandled_exception() const noexcept { std::terminate(); }
+            };
+
+            std::coroutine_handle<promise_type> coroHandle;
+
+            ~SyncWaitDriver()
+            {
+                if (coroHandle) {
+                    coroHandle.destroy();
+                }
+            }
+
+            void runAndWait()
+            {
+                Signal signal;
+                coroHandle.promise().signal = &signal;
+                coroHandle.resume();
+
+                std::unique_lock lock { signal.mutex };
+                signal.finished.wait(lock, [&signal] { return signal.done; });
+            }
+        };
+    }
+
+    namespace Details
+    {
+        /** Starts immediately and frees its own frame at the end: nobody can wait for it **/
+        struct Detached
+        {
+            struct promise_type
+            {
+                Detached get_return_object() const noexcept {
+                    return {};
+                }
+
+                std::suspend_never initial_suspend() const noexcept {
+                    return {};
+                }
+
+                std::suspend_never final_suspend() const noexcept {
+                    return {};
+                }
+
+                void return_void() const noexcept {}
+                void unhandled_exception() const noexcept { std::terminate(); }
+            };
+        };
+
+        /** Waits for completion only: the result (or the exception) is taken later by the owner **/
+        template<typename T>
+        struct JoinAwaiter
+        {
+            Task<T>& task;
+
+            [[nodiscard]]
+            bool await_ready() const {
+                return task.await_ready();
+            }
+
+            std::coroutine_handle<> await_suspend(const std::coroutine_handle<> caller) const noexcept {
+                return task.await_suspend(caller);
+            }
+
+            void await_resume() const noexcept {
+            }
+        };
+
+        /**
+         * Starts every task, resumes the awaiting coroutine from whichever task finishes last.
+         * The counter starts at size + 1: the extra unit belongs to await_suspend() itself, so
+         * tasks that all complete synchronously never race with the suspension.
+        **/
+        template<typename T>
+        struct WhenAllAwaiter
+        {
+            std::vector<Task<T>>& tasks;
+            std::atomic<size_t> remaining { 0 };
+            std::coroutine_handle<> continuation {};
+
+            [[nodiscard]]
+            bool await_ready() const noexcept {
+                return tasks.empty();
+            }
+
+            bool await_suspend(const std::coroutine_handle<> caller)
+            {
+                continuation = caller;
+                remaining.store(tasks.size() + 1, std::memory_order_relaxed);
+                for (Task<T>& task: tasks)
+                {
+                    [](Task<T>& child, WhenAllAwaiter& self) -> Detached {
+                        co_await JoinAwaiter<T> { child };
+                        if (1 == self.remaining.fetch_sub(1, std::memory_order_acq_rel)) {
+                            self.continuation.resume();
+                        }
+                    }(task, *this);
+                }
+                return 1 != remaining.fetch_sub(1, std::memory_order_acq_rel);
+            }
+
+            void await_resume() const noexcept {
+            }
+        };
+    }
+
+    /** Fire-and-forget: runs 'task' on the calling thread up to its first suspension. Must not throw **/
+    inline void spawn(Task<void> task)
+    {
+        [](Task<void> owned) -> Details::Detached {
+            co_await owned;
+        }(std::move(task));
+    }
+
+    /** Fan-out / fan-in: runs all tasks concurrently, results in the same order. Rethrows the first failure **/
+    template<typename T>
+    Task<std::conditional_t<std::is_void_v<T>, void, std::vector<T>>> whenAll(std::vector<Task<T>> tasks)
+    {
+        /** Checked up front: a child that fails to start would otherwise terminate its Detached driver **/
+        for (const Task<T>& task: tasks) {
+            if (!task.handle()) {
+                throw std::logic_error("whenAll: empty task");
+            }
+        }
+        co_await Details::WhenAllAwaiter<T> { tasks };
+
+        if constexpr (std::is_void_v<T>)
+        {
+            for (Task<T>& task: tasks) {
+                task.handle().promise().result();
+            }
+        }
+        else
+        {
+            std::vector<T> results;
+            results.reserve(tasks.size());
+            for (Task<T>& task: tasks) {
+                results.push_back(task.handle().promise().result());
+            }
+            co_return results;
+        }
+    }
+
+    /** Blocks the calling thread until 'task' completes, wherever it is resumed. Rethrows its exception **/
+    template<typename T>
+    T syncWait(Task<T> task)
+    {
+        if (!task.handle()) {
+            throw std::logic_error("syncWait: empty task");
+        }
+        Details::SyncWaitDriver driver = [](Task<T>& awaited) -> Details::SyncWaitDriver {
+            co_await Details::JoinAwaiter<T> { awaited };
+        }(task);
+        driver.runAndWait();
+        return task.handle().promise().result();
+    }
+}
+
+#endif //CPPCOROUTINES_TASK_H
@@ -0,0 +1,95 @@
+/**============================================================================
+Name        : ThreadPool.cpp
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Bounded worker pool running intrusive work items
+============================================================================**/
+
+#include "ThreadPool.h"
+
+#include <algorithm>
+
+namespace
+{
+    thread_local StdCoroutines::Runtime::ThreadPool* currentPool { nullptr };
+}
+
+namespace StdCoroutines::Runtime
+{
+    ThreadPool::ThreadPool(const size_t threads)
+    {
+        const size_t count = std::max<size_t>(1, threads);
+        workers.reserve(count);
+        for (size_t idx = 0; idx < count; ++idx) {
+            workers.emplace_back([this] { workerLoop(); });
+        }
+    }
+
+    ThreadPool::~ThreadPool()
+    {
+        {
+            std::lock_guard lock { mutex };
+            stopping = true;
+        }
+        available.notify_all();
+        workers.clear();
+    }
+
+    ThreadPool& ThreadPool::shared()
+    {
+        static ThreadPool pool { std::max(2u, std::thread::hardware_concurrency()) };
+        return pool;
+    }
+
+    ThreadPool* ThreadPool::current() noexcept {
+        return currentPool;
+    }
+
+    void ThreadPool::post(WorkItem* item) noexcept
+    {
+        item->next = nullptr;
+        bool wakeWorker { false };
+        {
+            std::lock_guard lock { mutex };
+            if (tail) {
+                tail->next = item;
+            } else {
+                head = item;
+            }
+            tail = item;
+            wakeWorker = idleWorkers > 0;
+        }
+        /** Busy workers will find the item anyway - skip the futex wake syscall then **/
+        if (wakeWorker) {
+            available.notify_one();
+        }
+    }
+
+    void ThreadPool::workerLoop()
+    {
+        currentPool = this;
+        while (true)
+        {
+            WorkItem* item { nullptr };
+            {
+                std::unique_lock lock { mutex };
+                while (!head && !stopping) {
+                    ++idleWorkers;
+                    available.wait(lock);
+                    --idleWorkers;
+                }
+                if (!head) {
+                    return;
+                }
+                item = head;
+                head = item->next;
+                if (!head) {
+                    tail = nullptr;
+                }
+            }
+            item->execute(item);
+        }
+    }
+}
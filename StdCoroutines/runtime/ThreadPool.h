@@ -0,0 +1,127 @@
+/**============================================================================
+Name        : ThreadPool.h
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Bounded worker pool running intrusive work items
+============================================================================**/
+
+#ifndef CPPCOROUTINES_THREADPOOL_H
+#define CPPCOROUTINES_THREADPOOL_H
+
+#include <condition_variable>
+#include <coroutine>
+#include <concepts>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "runtime/Tracing.h"
+
+namespace StdCoroutines::Runtime
+{
+    /**
+     * Intrusive node: whoever posts it owns the storage. Awaiters derive from it so that
+     * scheduling a coroutine onto the pool needs no allocation - the node lives in the frame.
+    **/
+    struct WorkItem
+    {
+        WorkItem* next { nullptr };
+        void (*execute)(WorkItem*) { nullptr };
+    };
+
+    /** Fixed number of workers sharing one FIFO of WorkItems **/
+    class ThreadPool
+    {
+        std::mutex mutex;
+        std::condition_variable available;
+        WorkItem* head { nullptr };
+        WorkItem* tail { nullptr };
+        size_t idleWorkers { 0 };
+        bool stopping { false };
+        std::vector<std::jthread> workers;
+
+        void workerLoop();
+
+    public:
+
+        /** co_await pool.schedule(): continue on one of the pool workers **/
+        struct ScheduleAwaiter : WorkItem
+        {
+            ThreadPool& pool;
+            std::coroutine_handle<> continuation {};
+
+            explicit ScheduleAwaiter(ThreadPool& pool) noexcept : WorkItem { nullptr, &resume }, pool { pool } {
+            }
+
+            [[nodiscard]]
+            bool await_ready() const noexcept {
+                /** TRUE ==> await_resume() or in case FALSE ==> await_suspend() will be called **/
+                return false;
+            }
+
+            void await_suspend(const std::coroutine_handle<> hInputCoro) noexcept {
+                continuation = hInputCoro;
+                Trace::record(hInputCoro, Trace::Event::Scheduled, "ThreadPool::schedule");
+                pool.post(this);
+            }
+
+            void await_resume() const noexcept {
+            }
+
+            static void resume(WorkItem* item) {
+                static_cast<ScheduleAwaiter*>(item)->continuation.resume();
+            }
+        };
+
+        explicit ThreadPool(size_t threads = std::thread::hardware_concurrency());
+
+        /** Runs everything already posted, then joins the workers **/
+        ~ThreadPool();
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        /** Process wide pool, one worker per hardware thread (at least two) **/
+        static ThreadPool& shared();
+
+        /** The pool whose worker runs the calling thread, nullptr on any other thread **/
+        [[nodiscard]]
+        static ThreadPool* current() noexcept;
+
+        [[nodiscard]]
+        size_t size() const noexcept {
+            return workers.size();
+        }
+
+        /** No allocation: the item must stay alive until its execute() has been called **/
+        void post(WorkItem* item) noexcept;
+
+        /** For callers without a frame to embed a WorkItem in: allocates one node per call **/
+        template<std::invocable Function>
+        void submit(Function&& function)
+        {
+            struct Job : WorkItem
+            {
+                std::decay_t<Function> function;
+            };
+
+            auto* job = new Job { WorkItem { nullptr, [](WorkItem* item) {
+                const std::unique_ptr<Job> self { static_cast<Job*>(item) };
+                self->function();
+            } }, std::forward<Function>(function) };
+            post(job);
+        }
+
+        [[nodiscard]]
+        ScheduleAwaiter schedule() noexcept {
+            return ScheduleAwaiter { *this };
+        }
+    };
+}
+
+#endif //CPPCOROUTINES_THREADPOOL_H
@@ -0,0 +1,202 @@
+/**============================================================================
+Name        : Timeout.h
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : co_await with_timeout(awaitable, d): races a cancellable awaitable against the timer service
+============================================================================**/
+
+#ifndef CPPCOROUTINES_TIMEOUT_H
+#define CPPCOROUTINES_TIMEOUT_H
+
+#include <atomic>
+#include <concepts>
+#include <coroutine>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#include "runtime/Task.h"
+#include "runtime/ThreadPool.h"
+#include "runtime/TimerService.h"
+
+namespace StdCoroutines::Runtime
+{
+    namespace Details
+    {
+        /** The awaiter co_await uses for 'Awaitable': a reference when it is its own awaiter **/
+        template<typename Awaitable>
+        using AwaiterOf = decltype(awaiterOf(std::declval<Awaitable&>()));
+
+        /**
+         * Awaitables whose awaiter can be completed early: cancel() wakes a waiting awaiter up,
+         * interrupted() tells afterwards whether that is how the wait ended
+        **/
+        template<typename Awaitable>
+        concept Cancellable = requires(std::remove_reference_t<AwaiterOf<Awaitable>>& awaiter) {
+            awaiter.cancel();
+            { awaiter.interrupted() } -> std::convertible_to<bool>;
+        };
+
+        /**
+         * Shared by the awaiting coroutine, the child coroutine awaiting 'awaitable' and the timer.
+         * The timer never decides anything: it only cancels the awaiter, so the child alone knows
+         * whether the awaitable completed in time - a signal that arrives while the timer is being
+         * handled is never lost. 'handshake' starts at 3 - await_suspend(), the child and the timer
+         * (counted by the child when it takes the timer out): the last of them resumes the caller,
+         * so nothing touches the awaitable once the caller goes on.
+        **/
+        template<typename Awaitable>
+        struct TimeoutState : WorkItem, TimerNode
+        {
+            using Result = AwaitResult<Awaitable>;
+
+            Awaitable awaitable;
+
+            /** Lives here, not in the child frame: the expired timer cancels it while the child waits **/
+            AwaiterOf<Awaitable> awaiter;
+
+            ThreadPool& pool;
+            TimerService& timers;
+            std::coroutine_handle<> continuation {};
+
+            /** void awaitables: whether it completed in time; otherwise its value, if it did **/
+            std::conditional_t<std::is_void_v<Result>, bool, std::optional<Result>> result {};
+
+            std::atomic<uint32_t> handshake { 3 };
+            std::atomic<uint32_t> references { 1 };
+
+            template<typename A>
+            TimeoutState(A&& awaitable, ThreadPool& pool, TimerService& timers) :
+                    WorkItem { nullptr, &expire }, TimerNode { {}, notArmed, &onExpired },
+                    awaitable { std::forward<A>(awaitable) }, awaiter { awaiterOf(this->awaitable) },
+                    pool { pool }, timers { timers } {
+            }
+
+            void release() noexcept
+            {
+                if (1 == references.fetch_sub(1, std::memory_order_acq_rel)) {
+                    delete this;
+                }
+            }
+
+            void arrive(const uint32_t parties)
+            {
+                if (parties == handshake.fetch_sub(parties, std::memory_order_acq_rel)) {
+                    continuation.resume();
+                }
+            }
+
+            /** Nothing is cancelled or resumed on the timer thread **/
+            static void onExpired(TimerNode* node) {
+                auto* const self = static_cast<TimeoutState*>(node);
+                self->pool.post(self);
+            }
+
+            static void expire(WorkItem* item)
+            {
+                auto* const self = static_cast<TimeoutState*>(item);
+                self->awaiter.cancel();
+                self->arrive(1);
+                self->release();
+            }
+        };
+
+        template<typename Awaitable>
+        Detached raceAwaitable(TimeoutState<Awaitable>* state)
+        {
+            using Result = typename TimeoutState<Awaitable>::Result;
+
+            if constexpr (std::is_void_v<Result>) {
+                co_await state->awaiter;
+                state->result = !state->awaiter.interrupted();
+            } else {
+                Result value = co_await state->awaiter;
+                if (!state->awaiter.interrupted())
+                    state->result.emplace(std::move(value));
+            }
+
+            /** A cancelled timer will never run expire(): its part of the handshake is done here **/
+            if (state->timers.cancel(state)) {
+                state->release();
+                state->arrive(2);
+            } else {
+                state->arrive(1);
+            }
+            state->release();
+        }
+    }
+
+    /**
+     * co_await with_timeout(awaitable, d) resumes the caller exactly once: with the result of
+     * 'awaitable' (std::optional<T>, or true for void) or, after 'd', with nullopt / false.
+     * 'awaitable' runs in a small child coroutine; when the timer expires first, the awaiter
+     * is cancelled, so the child finishes right away and frees the shared state - no frame is
+     * left waiting and a later signal is never taken by a dead waiter. Hence only Cancellable
+     * awaitables are accepted. A timeout resumes the caller on 'pool'; an awaitable that wins
+     * resumes it wherever it completes. Lvalue awaitables are referenced, rvalues are moved in.
+    **/
+    template<Details::Cancellable Awaitable>
+    class [[nodiscard]] TimeoutAwaiter
+    {
+        using State = Details::TimeoutState<Awaitable>;
+
+        State* state;
+        Clock::duration timeout;
+
+    public:
+
+        TimeoutAwaiter(Awaitable&& awaitable, const Clock::duration timeout, ThreadPool& pool, TimerService& timers) :
+                state { new State { std::forward<Awaitable>(awaitable), pool, timers } }, timeout { timeout } {
+        }
+
+        TimeoutAwaiter(TimeoutAwaiter&& other) noexcept :
+                state { std::exchange(other.state, nullptr) }, timeout { other.timeout } {
+        }
+
+        TimeoutAwaiter(const TimeoutAwaiter&) = delete;
+        TimeoutAwaiter& operator=(const TimeoutAwaiter&) = delete;
+        TimeoutAwaiter& operator=(TimeoutAwaiter&&) = delete;
+
+        ~TimeoutAwaiter()
+        {
+            if (state) {
+                state->release();
+            }
+        }
+
+        [[nodiscard]]
+        bool await_ready() const noexcept {
+            /** TRUE ==> await_resume() or in case FALSE ==> await_suspend() will be called **/
+            return false;
+        }
+
+        bool await_suspend(const std::coroutine_handle<> hInputCoro)
+        {
+            state->continuation = hInputCoro;
+
+            /** The child and the timer each hold a reference from here on **/
+            state->references.fetch_add(2, std::memory_order_relaxed);
+            state->deadline = Clock::now() + timeout;
+            state->timers.arm(state);
+            Details::raceAwaitable(state);
+            return 1 != state->handshake.fetch_sub(1, std::memory_order_acq_rel);
+        }
+
+        auto await_resume() {
+            return std::move(state->result);
+        }
+    };
+
+    template<Details::Cancellable Awaitable>
+    TimeoutAwaiter<Awaitable> with_timeout(Awaitable&& awaitable,
+                                           const Clock::duration timeout,
+                                           ThreadPool& pool = ThreadPool::shared(),
+                                           TimerService& timers = TimerService::shared())
+    {
+        return TimeoutAwaiter<Awaitable> { std::forward<Awaitable>(awaitable), timeout, pool, timers };
+    }
+}
+
+#endif //CPPCOROUTINES_TIMEOUT_H
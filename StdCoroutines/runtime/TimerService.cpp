@@ -0,0 +1,160 @@
+/**============================================================================
+Name        : TimerService.cpp
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Timer thread with an intrusive deadline heap + co_await sleep_for()
+============================================================================**/
+
+#include "TimerService.h"
+
+#include <sys/prctl.h>
+
+namespace StdCoroutines::Runtime
+{
+    TimerService::TimerService()
+    {
+        heap.reserve(1024);
+        due.reserve(1024);
+        thread = std::jthread { [this] { run(); } };
+    }
+
+    TimerService::~TimerService()
+    {
+        stopping.store(true, std::memory_order_release);
+        wakeup.notify();
+        thread.join();
+    }
+
+    TimerService& TimerService::shared()
+    {
+        static TimerService service;
+        return service;
+    }
+
+    void TimerService::place(const size_t idx, TimerNode* node) noexcept
+    {
+        heap[idx] = node;
+        node->heapIndex = idx;
+    }
+
+    void TimerService::siftUp(size_t idx) noexcept
+    {
+        TimerNode* const node = heap[idx];
+        while (idx > 0)
+        {
+            const size_t parent = (idx - 1) / 2;
+            if (heap[parent]->deadline <= node->deadline) {
+                break;
+            }
+            place(idx, heap[parent]);
+            idx = parent;
+        }
+        place(idx, node);
+    }
+
+    void TimerService::siftDown(size_t idx) noexcept
+    {
+        TimerNode* const node = heap[idx];
+        const size_t size = heap.size();
+        while (true)
+        {
+            size_t child = 2 * idx + 1;
+            if (child >= size) {
+                break;
+            }
+            if (child + 1 < size && heap[child + 1]->deadline < heap[child]->deadline) {
+                ++child;
+            }
+            if (node->deadline <= heap[child]->deadline) {
+                break;
+            }
+            place(idx, heap[child]);
+            idx = child;
+        }
+        place(idx, node);
+    }
+
+    void TimerService::removeAt(const size_t idx) noexcept
+    {
+        heap[idx]->heapIndex = TimerNode::notArmed;
+        TimerNode* const last = heap.back();
+        heap.pop_back();
+        if (idx < heap.size())
+        {
+            place(idx, last);
+            siftDown(idx);
+            siftUp(last->heapIndex);
+        }
+    }
+
+    void TimerService::arm(TimerNode* node)
+    {
+        bool earliest { false };
+        {
+            std::lock_guard lock { mutex };
+            heap.push_back(node);
+            siftUp(heap.size() - 1);
+            earliest = (0 == node->heapIndex);
+        }
+        /** Only a new earliest deadline changes how long the timer thread has to sleep **/
+        if (earliest) {
+            wakeup.notify();
+        }
+    }
+
+    bool TimerService::cancel(TimerNode* node)
+    {
+        std::lock_guard lock { mutex };
+        if (TimerNode::notArmed == node->heapIndex) {
+            return false;
+        }
+        removeAt(node->heapIndex);
+        return true;
+    }
+
+    size_t TimerService::pending()
+    {
+        std::lock_guard lock { mutex };
+        return heap.size();
+    }
+
+    void TimerService::run()
+    {
+        /** Default 50us slack would show up directly as wakeup lateness **/
+        ::prctl(PR_SET_TIMERSLACK, 1UL, 0UL, 0UL, 0UL);
+
+        while (!stopping.load(std::memory_order_acquire))
+        {
+            Clock::time_point next = Clock::time_point::max();
+            {
+                std::lock_guard lock { mutex };
+                const Clock::time_point now = Clock::now();
+                while (!heap.empty() && heap.front()->deadline <= now) {
+                    due.push_back(heap.front());
+                    removeAt(0);
+                }
+                if (!heap.empty()) {
+                    next = heap.front()->deadline;
+                }
+            }
+
+            /** Outside the lock: a cancel() racing with this already sees 'not armed' and returns false **/
+            for (TimerNode* node: due) {
+                node->expired(node);
+            }
+            due.clear();
+
+            /** A futex timeout costs tens of microseconds: for deadlines closer than that just yield **/
+            constexpr Clock::duration spinThreshold = std::chrono::microseconds { 50 };
+            if (Clock::time_point::max() == next) {
+                wakeup.wait();
+            } else if (const Clock::time_point now = Clock::now(); next - now > spinThreshold) {
+                wakeup.waitFor(next - now - spinThreshold / 2);
+            } else {
+                std::this_thread::yield();
+            }
+        }
+    }
+}
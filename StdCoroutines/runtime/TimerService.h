@@ -0,0 +1,174 @@
+/**============================================================================
+Name        : TimerService.h
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Timer thread with an intrusive deadline heap + co_await sleep_for()
+============================================================================**/
+
+#ifndef CPPCOROUTINES_TIMERSERVICE_H
+#define CPPCOROUTINES_TIMERSERVICE_H
+
+#include <atomic>
+#include <chrono>
+#include <coroutine>
+#include <cstddef>
+#include <limits>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "runtime/ThreadPool.h"
+#include "runtime/Tracing.h"
+#include "runtime/WaitEvent.h"
+
+namespace StdCoroutines::Runtime
+{
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * Intrusive timer: lives in the awaiter (the coroutine frame). 'expired' runs on the timer
+     * thread and must only hand the work over (e.g. post to a pool), never block.
+    **/
+    struct TimerNode
+    {
+        static constexpr size_t notArmed = std::numeric_limits<size_t>::max();
+
+        Clock::time_point deadline {};
+        size_t heapIndex { notArmed };
+        void (*expired)(TimerNode*) { nullptr };
+    };
+
+    /**
+     * One thread sleeping until the earliest deadline. The heap stores node pointers and every
+     * node knows its position, so cancel() is O(log n) and a parked sleeper costs no CPU at all.
+    **/
+    class TimerService
+    {
+        std::mutex mutex;
+        std::vector<TimerNode*> heap;
+        std::vector<TimerNode*> due;
+        std::atomic<bool> stopping { false };
+        WaitEvent wakeup;
+        std::jthread thread;
+
+        void run();
+        void place(size_t idx, TimerNode* node) noexcept;
+        void siftUp(size_t idx) noexcept;
+        void siftDown(size_t idx) noexcept;
+        void removeAt(size_t idx) noexcept;
+
+    public:
+
+        TimerService();
+        ~TimerService();
+
+        TimerService(const TimerService&) = delete;
+        TimerService& operator=(const TimerService&) = delete;
+
+        static TimerService& shared();
+
+        void arm(TimerNode* node);
+
+        /** true - the timer will not fire; false - it has already fired (or is firing right now) **/
+        bool cancel(TimerNode* node);
+
+        [[nodiscard]]
+        size_t pending();
+    };
+
+    /**
+     * co_await sleep_for(d): parks the coroutine in the timer heap, resumes it on 'pool'.
+     * 'handshake' starts at 2 - the wake-up (timer or cancel()) and await_suspend(): whichever
+     * comes second resumes the sleeper, so await_suspend() may still look at the awaiter
+     * after arm() even if the timer fires at once.
+    **/
+    struct SleepAwaiter : WorkItem, TimerNode
+    {
+        Clock::duration duration;
+        ThreadPool& pool;
+        TimerService& timers;
+        std::coroutine_handle<> continuation {};
+        std::atomic<bool> cancelled { false };
+        std::atomic<uint32_t> handshake { 2 };
+        bool cutShort { false };
+
+        SleepAwaiter(const Clock::duration duration, ThreadPool& pool, TimerService& timers) noexcept :
+            WorkItem { nullptr, &resume }, TimerNode { {}, notArmed, &onExpired },
+            duration { duration }, pool { pool }, timers { timers } {
+        }
+
+        /** Only before it is awaited (e.g. handed over to with_timeout()) **/
+        SleepAwaiter(SleepAwaiter&& other) noexcept : SleepAwaiter { other.duration, other.pool, other.timers } {
+        }
+
+        [[nodiscard]]
+        bool await_ready() const noexcept {
+            /** TRUE ==> await_resume() or in case FALSE ==> await_suspend() will be called **/
+            return duration <= Clock::duration::zero();
+        }
+
+        bool await_suspend(const std::coroutine_handle<> hInputCoro)
+        {
+            continuation = hInputCoro;
+            if (cancelled.load(std::memory_order_seq_cst)) {
+                cutShort = true;
+                return false;
+            }
+            deadline = Clock::now() + duration;
+            timers.arm(this);
+
+            /** cancel() came in before the timer was armed: it found nothing to take out, this does **/
+            if (cancelled.load(std::memory_order_seq_cst) && timers.cancel(this)) {
+                cutShort = true;
+                return false;
+            }
+            return 1 != handshake.fetch_sub(1, std::memory_order_acq_rel);
+        }
+
+        void await_resume() const noexcept {
+        }
+
+        /** Wakes the sleeper up early (e.g. it lost a with_timeout() race). No effect once the timer has fired **/
+        void cancel()
+        {
+            cancelled.store(true, std::memory_order_seq_cst);
+            if (timers.cancel(this)) {
+                cutShort = true;
+                wakeUp(this);
+            }
+        }
+
+        /** After resumption: woken up by cancel() before the full duration had passed **/
+        [[nodiscard]]
+        bool interrupted() const noexcept {
+            return cutShort;
+        }
+
+        static void onExpired(TimerNode* node) {
+            wakeUp(static_cast<SleepAwaiter*>(node));
+        }
+
+        static void wakeUp(SleepAwaiter* self) {
+            if (1 == self->handshake.fetch_sub(1, std::memory_order_acq_rel)) {
+                Trace::record(self->continuation, Trace::Event::Scheduled, "sleep_for");
+                self->pool.post(self);
+            }
+        }
+
+        static void resume(WorkItem* item) {
+            static_cast<SleepAwaiter*>(item)->continuation.resume();
+        }
+    };
+
+    [[nodiscard]]
+    inline SleepAwaiter sleep_for(const Clock::duration duration,
+                                  ThreadPool& pool = ThreadPool::shared(),
+                                  TimerService& timers = TimerService::shared()) noexcept
+    {
+        return SleepAwaiter { duration, pool, timers };
+    }
+}
+
+#endif //CPPCOROUTINES_TIMERSERVICE_H
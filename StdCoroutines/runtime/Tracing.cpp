@@ -0,0 +1,246 @@
+/**============================================================================
+Name        : Tracing.cpp
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Coroutine lifecycle tracing (Chrome trace / Perfetto export)
+============================================================================**/
+
+#include "Tracing.h"
+
+#include <algorithm>
+#include <format>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+    using namespace StdCoroutines::Runtime::Trace;
+
+    struct ThreadTrace
+    {
+        static constexpr size_t capacity { 1 << 16 };
+
+        const uint32_t index;
+        std::unique_ptr<Record[]> records { std::make_unique<Record[]>(capacity) };
+        std::atomic<size_t> size { 0 };
+
+        explicit ThreadTrace(const uint32_t idx): index { idx } {
+        }
+    };
+
+    struct Session
+    {
+        std::mutex mutex;
+        std::vector<std::shared_ptr<ThreadTrace>> threads;
+        uint64_t startTicks { 0 };
+        std::chrono::steady_clock::time_point startTime;
+        uint64_t stopTicks { 0 };
+        std::chrono::steady_clock::time_point stopTime;
+
+        std::shared_ptr<ThreadTrace> attach()
+        {
+            std::lock_guard lock { mutex };
+            threads.push_back(std::make_shared<ThreadTrace>(static_cast<uint32_t>(threads.size())));
+            return threads.back();
+        }
+    };
+
+    Session& session()
+    {
+        static Session instance;
+        return instance;
+    }
+
+    ThreadTrace& threadTrace()
+    {
+        thread_local std::shared_ptr<ThreadTrace> local { session().attach() };
+        return *local;
+    }
+
+    struct CoroutineState
+    {
+        const char* name { nullptr };
+        bool running { false };
+        /** Suspend recorded and no Resume yet: only then does a Scheduled open a "queued" span **/
+        bool suspended { false };
+        uint32_t thread { 0 };
+        uint64_t since { 0 };
+        uint64_t scheduled { 0 };
+    };
+
+    struct Entry
+    {
+        Record record;
+        uint32_t thread;
+    };
+}
+
+namespace StdCoroutines::Runtime::Trace
+{
+    void start()
+    {
+        Session& ses = session();
+        {
+            std::lock_guard lock { ses.mutex };
+            for (const std::shared_ptr<ThreadTrace>& thread: ses.threads)
+                thread->size.store(0, std::memory_order_relaxed);
+            ses.startTime = std::chrono::steady_clock::now();
+            ses.startTicks = ticks();
+        }
+        enabled.store(true, std::memory_order_release);
+    }
+
+    void stop()
+    {
+        enabled.store(false, std::memory_order_release);
+        Session& ses = session();
+        std::lock_guard lock { ses.mutex };
+        ses.stopTime = std::chrono::steady_clock::now();
+        ses.stopTicks = ticks();
+    }
+
+    void write(const void* coroutine, const Event event, const char* name) noexcept
+    {
+        ThreadTrace& trace = threadTrace();
+        const size_t pos = trace.size.load(std::memory_order_relaxed);
+        if (pos < ThreadTrace::capacity) {
+            trace.records[pos] = Record { ticks(), coroutine, name, event };
+            trace.size.store(pos + 1, std::memory_order_release);
+        }
+    }
+
+    bool exportChromeTrace(const std::filesystem::path& filePath)
+    {
+        Session& ses = session();
+        std::vector<Entry> entries;
+        double ticksPerMicrosecond { 1.0 };
+        uint64_t origin { 0 };
+        size_t threadsCount { 0 };
+        {
+            std::lock_guard lock { ses.mutex };
+            for (const std::shared_ptr<ThreadTrace>& thread: ses.threads)
+            {
+                const size_t size = thread->size.load(std::memory_order_acquire);
+                for (size_t i = 0; i < size; ++i)
+                    entries.push_back(Entry { thread->records[i], thread->index });
+            }
+            threadsCount = ses.threads.size();
+
+            const uint64_t endTicks = enabled.load() ? ticks() : ses.stopTicks;
+            const auto endTime = enabled.load() ? std::chrono::steady_clock::now() : ses.stopTime;
+            const double micros = std::chrono::duration<double, std::micro>(endTime - ses.startTime).count();
+            if (micros > 0 && endTicks > ses.startTicks)
+                ticksPerMicrosecond = static_cast<double>(endTicks - ses.startTicks) / micros;
+            origin = ses.startTicks;
+        }
+
+        std::ranges::sort(entries, {}, [](const Entry& entry) { return entry.record.ticks; });
+
+        std::ofstream file(filePath);
+        if (!file.is_open()) {
+            return false;
+        }
+
+        auto micros = [&](const uint64_t value) {
+            return static_cast<double>(value - std::min(value, origin)) / ticksPerMicrosecond;
+        };
+
+        bool first = true;
+        auto emit = [&](const std::string& json) {
+            file << (first ? "\n  " : ",\n  ") << json;
+            first = false;
+        };
+
+        file << R"({"displayTimeUnit":"ns","traceEvents":[)";
+        for (size_t idx = 0; idx < threadsCount; ++idx) {
+            emit(std::format(R"({{"name":"thread_name","ph":"M","pid":1,"tid":{},"args":{{"name":"thread {}"}}}})",
+                             idx, idx));
+        }
+
+        std::unordered_map<const void*, CoroutineState> coroutines;
+        for (const auto& [record, thread]: entries)
+        {
+            /** The runtime's queues record Scheduled for every coroutine, traced or not: those must not create state **/
+            if (Event::Scheduled == record.event)
+            {
+                const auto iter = coroutines.find(record.coroutine);
+                if (coroutines.end() != iter && iter->second.suspended && 0 == iter->second.scheduled) {
+                    iter->second.scheduled = record.ticks;
+                    emit(std::format(R"({{"name":"queued","cat":"coroutine","ph":"b","ts":{:.3f},"pid":1,"tid":{},"id":"{}"}})",
+                                     micros(record.ticks), thread, record.coroutine));
+                }
+                continue;
+            }
+
+            CoroutineState& state = coroutines[record.coroutine];
+            const char* awaiter = record.name ? record.name : "";
+            switch (record.event)
+            {
+                case Event::Created:
+                    state = CoroutineState { record.name, true, false, thread, record.ticks, 0 };
+                    emit(std::format(R"({{"name":"created","ph":"i","s":"t","ts":{:.3f},"pid":1,"tid":{},"args":{{"coroutine":"{}"}}}})",
+                                     micros(record.ticks), thread, record.coroutine));
+                    break;
+
+                case Event::Suspend:
+                    if (state.running) {
+                        emit(std::format(R"({{"name":"{}","ph":"X","ts":{:.3f},"dur":{:.3f},"pid":1,"tid":{},"args":{{"coroutine":"{}","awaiter":"{}"}}}})",
+                                         state.name ? state.name : "coroutine", micros(state.since),
+                                         micros(record.ticks) - micros(state.since), thread, record.coroutine, awaiter));
+                    }
+                    emit(std::format(R"({{"name":"suspended","cat":"coroutine","ph":"b","ts":{:.3f},"pid":1,"tid":{},"id":"{}","args":{{"awaiter":"{}"}}}})",
+                                     micros(record.ticks), thread, record.coroutine, awaiter));
+                    state.running = false;
+                    state.suspended = true;
+                    state.thread = thread;
+                    state.since = record.ticks;
+                    state.scheduled = 0;
+                    break;
+
+                case Event::Scheduled:  // handled above
+                    break;
+
+                case Event::Resume:
+                    if (!state.running)
+                    {
+                        if (0 != state.scheduled) {
+                            emit(std::format(R"({{"name":"queued","cat":"coroutine","ph":"e","ts":{:.3f},"pid":1,"tid":{},"id":"{}"}})",
+                                             micros(record.ticks), thread, record.coroutine));
+                        }
+                        emit(std::format(R"({{"name":"suspended","cat":"coroutine","ph":"e","ts":{:.3f},"pid":1,"tid":{},"id":"{}"}})",
+                                         micros(record.ticks), thread, record.coroutine));
+                        if (state.thread != thread) {
+                            emit(std::format(R"({{"name":"migration","cat":"coroutine","ph":"s","ts":{:.3f},"pid":1,"tid":{},"id":"{}"}})",
+                                             micros(state.since), state.thread, record.coroutine));
+                            emit(std::format(R"({{"name":"migration","cat":"coroutine","ph":"f","bp":"e","ts":{:.3f},"pid":1,"tid":{},"id":"{}"}})",
+                                             micros(record.ticks), thread, record.coroutine));
+                        }
+                    }
+                    state.running = true;
+                    state.suspended = false;
+                    state.thread = thread;
+                    state.since = record.ticks;
+                    state.scheduled = 0;
+                    break;
+
+                case Event::Finished:
+                    if (state.running) {
+                        emit(std::format(R"({{"name":"{}","ph":"X","ts":{:.3f},"dur":{:.3f},"pid":1,"tid":{},"args":{{"coroutine":"{}"}}}})",
+                                         state.name ? state.name : "coroutine", micros(state.since),
+                                         micros(record.ticks) - micros(state.since), thread, record.coroutine));
+                    }
+                    emit(std::format(R"({{"name":"finished","ph":"i","s":"t","ts":{:.3f},"pid":1,"tid":{},"args":{{"coroutine":"{}"}}}})",
+                                     micros(record.ticks), thread, record.coroutine));
+                    coroutines.erase(record.coroutine);
+                    break;
+            }
+        }
+        file << "\n]}\n";
+        return file.good();
+    }
+}
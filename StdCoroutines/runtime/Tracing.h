@@ -0,0 +1,109 @@
+/**============================================================================
+Name        : Tracing.h
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Coroutine lifecycle tracing (Chrome trace / Perfetto export)
+============================================================================**/
+
+#ifndef CPPCOROUTINES_TRACING_H
+#define CPPCOROUTINES_TRACING_H
+
+#include <atomic>
+#include <chrono>
+#include <coroutine>
+#include <cstdint>
+#include <filesystem>
+#include <type_traits>
+#include <utility>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+namespace StdCoroutines::Runtime::Trace
+{
+    enum class Event : uint8_t
+    {
+        Created,     // coroutine frame created, body is about to run (or to hit initial_suspend)
+        Suspend,     // coroutine is leaving the thread at a suspension point
+        Scheduled,   // somebody made the suspended coroutine ready (queueing delay starts here)
+        Resume,      // coroutine runs again
+        Finished     // final_suspend reached
+    };
+
+    struct Record
+    {
+        uint64_t ticks { 0 };
+        const void* coroutine { nullptr };
+        const char* name { nullptr };
+        Event event { Event::Created };
+    };
+
+    /** Relaxed flag: when tracing is off every hook costs one load and one (predicted) branch **/
+    inline std::atomic<bool> enabled { false };
+
+    [[nodiscard]]
+    inline uint64_t ticks() noexcept
+    {
+#if defined(__x86_64__) || defined(__i386__)
+        return __rdtsc();
+#else
+        return std::chrono::steady_clock::now().time_since_epoch().count();
+#endif
+    }
+
+    void start();
+    void stop();
+
+    /** Slow path: appends to the per-thread buffer. Records are dropped once the buffer is full **/
+    void write(const void* coroutine, Event event, const char* name) noexcept;
+
+    /** Writes everything recorded so far as Chrome trace JSON (chrome://tracing, ui.perfetto.dev) **/
+    bool exportChromeTrace(const std::filesystem::path& filePath);
+
+    inline void record(const std::coroutine_handle<> handle, const Event event, const char* name = nullptr) noexcept
+    {
+        if (enabled.load(std::memory_order_relaxed)) [[unlikely]] {
+            write(handle.address(), event, name);
+        }
+    }
+
+    /** Wraps any awaiter, recording Suspend before it hands the coroutine away and Resume when it comes back **/
+    template<typename Awaiter>
+    struct Traced
+    {
+        Awaiter awaiter;
+        const char* name { nullptr };
+        std::coroutine_handle<> handle {};
+
+        bool await_ready() noexcept(noexcept(awaiter.await_ready())) {
+            return awaiter.await_ready();
+        }
+
+        template<typename Promise>
+        auto await_suspend(const std::coroutine_handle<Promise> coroHandle)
+        {
+            handle = coroHandle;
+            record(coroHandle, Event::Suspend, name);
+            return awaiter.await_suspend(coroHandle);
+        }
+
+        decltype(auto) await_resume()
+        {
+            if (handle) {
+                record(handle, Event::Resume, name);
+            }
+            return awaiter.await_resume();
+        }
+    };
+
+    template<typename Awaiter>
+    Traced<std::remove_cvref_t<Awaiter>> traced(Awaiter&& awaiter, const char* name = nullptr)
+    {
+        return Traced<std::remove_cvref_t<Awaiter>> { std::forward<Awaiter>(awaiter), name };
+    }
+}
+
+#endif //CPPCOROUTINES_TRACING_H
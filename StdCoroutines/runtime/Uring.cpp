@@ -0,0 +1,301 @@
+/**============================================================================
+Name        : Uring.cpp
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : io_uring event loop: awaitable read/write/accept/timeout/fsync
+============================================================================**/
+
+#include "Uring.h"
+
+#include <algorithm>
+#include <new>
+#include <system_error>
+
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+namespace
+{
+    int ioUringSetup(const unsigned entries, io_uring_params& params) {
+        return static_cast<int>(::syscall(__NR_io_uring_setup, entries, &params));
+    }
+
+    int ioUringEnter(const int fd, const unsigned toSubmit, const unsigned minComplete, const unsigned flags) {
+        return static_cast<int>(::syscall(__NR_io_uring_enter, fd, toSubmit, minComplete, flags, nullptr, 0));
+    }
+
+    int ioUringRegister(const int fd, const unsigned opcode, const void* args, const unsigned count) {
+        return static_cast<int>(::syscall(__NR_io_uring_register, fd, opcode, args, count));
+    }
+
+    template<typename T>
+    T* at(void* base, const size_t offset) noexcept {
+        return reinterpret_cast<T*>(static_cast<char*>(base) + offset);
+    }
+}
+
+namespace StdCoroutines::Runtime
+{
+    Uring::Uring(const Options& options): options { options }
+    {
+        io_uring_params params {};
+        if (options.sqPoll) {
+            params.flags |= IORING_SETUP_SQPOLL;
+            params.sq_thread_idle = static_cast<unsigned>(options.sqPollIdle.count());
+        }
+        ringFd = ioUringSetup(options.entries, params);
+        if (ringFd < 0) {
+            throw std::system_error(errno, std::system_category(), "io_uring_setup");
+        }
+
+        sqRingSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+        cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        const bool singleMmap = params.features & IORING_FEAT_SINGLE_MMAP;
+        if (singleMmap) {
+            sqRingSize = cqRingSize = std::max(sqRingSize, cqRingSize);
+        }
+
+        constexpr int protection = PROT_READ | PROT_WRITE;
+        constexpr int flags = MAP_SHARED | MAP_POPULATE;
+        sqRing = ::mmap(nullptr, sqRingSize, protection, flags, ringFd, IORING_OFF_SQ_RING);
+        cqRing = (MAP_FAILED == sqRing || singleMmap) ? sqRing
+                : ::mmap(nullptr, cqRingSize, protection, flags, ringFd, IORING_OFF_CQ_RING);
+        sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+        void* const sqesMemory = (MAP_FAILED == cqRing) ? MAP_FAILED
+                : ::mmap(nullptr, sqesSize, protection, flags, ringFd, IORING_OFF_SQES);
+        if (MAP_FAILED == sqesMemory)
+        {
+            const int error = errno;
+            if (MAP_FAILED != cqRing && cqRing != sqRing)
+                ::munmap(cqRing, cqRingSize);
+            if (MAP_FAILED != sqRing)
+                ::munmap(sqRing, sqRingSize);
+            ::close(ringFd);
+            throw std::system_error(error, std::system_category(), "io_uring mmap");
+        }
+        sqes = static_cast<io_uring_sqe*>(sqesMemory);
+
+        sqHead = at<unsigned>(sqRing, params.sq_off.head);
+        sqTail = at<unsigned>(sqRing, params.sq_off.tail);
+        sqFlags = at<unsigned>(sqRing, params.sq_off.flags);
+        sqMask = *at<unsigned>(sqRing, params.sq_off.ring_mask);
+        sqEntries = *at<unsigned>(sqRing, params.sq_off.ring_entries);
+
+        cqHead = at<unsigned>(cqRing, params.cq_off.head);
+        cqTail = at<unsigned>(cqRing, params.cq_off.tail);
+        cqMask = *at<unsigned>(cqRing, params.cq_off.ring_mask);
+        cqes = at<io_uring_cqe>(cqRing, params.cq_off.cqes);
+
+        /** SQE slot i is always submitted through array entry i **/
+        unsigned* const array = at<unsigned>(sqRing, params.sq_off.array);
+        for (unsigned idx = 0; idx < sqEntries; ++idx) {
+            array[idx] = idx;
+        }
+    }
+
+    Uring::~Uring()
+    {
+        ::munmap(sqes, sqesSize);
+        if (cqRing != sqRing) {
+            ::munmap(cqRing, cqRingSize);
+        }
+        ::munmap(sqRing, sqRingSize);
+        ::close(ringFd);
+    }
+
+    void Uring::registerFiles(const std::span<const int> fds)
+    {
+        if (!files.empty()) {
+            ioUringRegister(ringFd, IORING_UNREGISTER_FILES, nullptr, 0);
+            files.clear();
+        }
+        if (ioUringRegister(ringFd, IORING_REGISTER_FILES, fds.data(), static_cast<unsigned>(fds.size())) < 0) {
+            throw std::system_error(errno, std::system_category(), "IORING_REGISTER_FILES");
+        }
+        files.assign(fds.begin(), fds.end());
+    }
+
+    void Uring::registerBuffers(const size_t count, const size_t size)
+    {
+        constexpr size_t pageSize { 4096 };
+        const size_t alignedSize = (size + pageSize - 1) / pageSize * pageSize;
+        if (buffersCount > 0) {
+            ioUringRegister(ringFd, IORING_UNREGISTER_BUFFERS, nullptr, 0);
+        }
+
+        bufferArena.reset(static_cast<char*>(std::aligned_alloc(pageSize, count * alignedSize)));
+        if (!bufferArena) {
+            throw std::bad_alloc {};
+        }
+        bufferSize = alignedSize;
+        buffersCount = count;
+
+        std::vector<iovec> vectors(count);
+        for (size_t idx = 0; idx < count; ++idx) {
+            vectors[idx] = iovec { bufferArena.get() + idx * alignedSize, alignedSize };
+        }
+        if (ioUringRegister(ringFd, IORING_REGISTER_BUFFERS, vectors.data(), static_cast<unsigned>(count)) < 0) {
+            buffersCount = 0;
+            throw std::system_error(errno, std::system_category(), "IORING_REGISTER_BUFFERS");
+        }
+    }
+
+    io_uring_sqe* Uring::acquire()
+    {
+        /** Ring full: hand what is queued to the kernel (or wait for the SQPOLL thread to take it) **/
+        while (*sqTail - __atomic_load_n(sqHead, __ATOMIC_ACQUIRE) == sqEntries)
+        {
+            if (options.sqPoll) {
+                ioUringEnter(ringFd, 0, 0, IORING_ENTER_SQ_WAIT);
+                ++statistics.enterCalls;
+            } else {
+                enter(unsubmitted, 0);
+            }
+        }
+        return &sqes[*sqTail & sqMask];
+    }
+
+    void Uring::Awaiter::await_suspend(const std::coroutine_handle<> hInputCoro)
+    {
+        continuation = hInputCoro;
+        io_uring_sqe* const sqe = ring.acquire();
+        *sqe = request;
+        sqe->user_data = reinterpret_cast<uint64_t>(this);
+        if (IORING_OP_TIMEOUT == request.opcode) {
+            sqe->addr = reinterpret_cast<uint64_t>(&timeout);
+        }
+
+        /** Published right away: an SQPOLL thread may pick it up before the next run() iteration **/
+        __atomic_store_n(ring.sqTail, *ring.sqTail + 1, __ATOMIC_RELEASE);
+        ++ring.unsubmitted;
+        ++ring.inFlight;
+        ++ring.statistics.submitted;
+    }
+
+    void Uring::enter(const unsigned toSubmit, const unsigned minComplete)
+    {
+        unsigned flags = (minComplete > 0) ? IORING_ENTER_GETEVENTS : 0;
+        if (options.sqPoll && (__atomic_load_n(sqFlags, __ATOMIC_ACQUIRE) & IORING_SQ_NEED_WAKEUP)) {
+            flags |= IORING_ENTER_SQ_WAKEUP;
+        }
+        if (0 == toSubmit && 0 == flags) {
+            return;
+        }
+
+        const int submitted = ioUringEnter(ringFd, toSubmit, minComplete, flags);
+        ++statistics.enterCalls;
+        if (submitted < 0)
+        {
+            if (EINTR == errno || EAGAIN == errno || EBUSY == errno) {
+                return;
+            }
+            throw std::system_error(errno, std::system_category(), "io_uring_enter");
+        }
+        unsubmitted -= std::min(unsubmitted, static_cast<unsigned>(submitted));
+    }
+
+    void Uring::reap()
+    {
+        unsigned head = *cqHead;
+        while (head != __atomic_load_n(cqTail, __ATOMIC_ACQUIRE))
+        {
+            const io_uring_cqe& cqe = cqes[head & cqMask];
+            auto* const operation = reinterpret_cast<Awaiter*>(cqe.user_data);
+            operation->result = cqe.res;
+
+            /** The slot goes back to the kernel before the coroutine runs and queues more work **/
+            __atomic_store_n(cqHead, ++head, __ATOMIC_RELEASE);
+            --inFlight;
+            ++statistics.completed;
+            operation->continuation.resume();
+            head = *cqHead;
+        }
+    }
+
+    void Uring::run()
+    {
+        stopping = false;
+        while (!stopping && inFlight > 0)
+        {
+            const bool completed = *cqHead != __atomic_load_n(cqTail, __ATOMIC_ACQUIRE);
+            if (options.sqPoll)
+            {
+                /** The kernel thread submits on its own: only wake it up or sleep for completions **/
+                unsubmitted = 0;
+                enter(0, completed ? 0 : 1);
+            }
+            else if (unsubmitted > 0 || !completed) {
+                enter(unsubmitted, completed ? 0 : 1);
+            }
+            reap();
+        }
+    }
+
+    Uring::Awaiter Uring::make(Uring& ring, const uint8_t opcode, const int fd, const void* address,
+                               const uint32_t length, const uint64_t offset) noexcept
+    {
+        Awaiter awaiter { ring };
+        awaiter.request.opcode = opcode;
+        awaiter.request.fd = fd;
+        awaiter.request.addr = reinterpret_cast<uint64_t>(address);
+        awaiter.request.len = length;
+        awaiter.request.off = offset;
+        return awaiter;
+    }
+
+    Uring::Awaiter Uring::read(const int fd, const std::span<char> buffer, const uint64_t offset) noexcept {
+        return make(*this, IORING_OP_READ, fd, buffer.data(), static_cast<uint32_t>(buffer.size()), offset);
+    }
+
+    Uring::Awaiter Uring::write(const int fd, const std::span<const char> buffer, const uint64_t offset) noexcept {
+        return make(*this, IORING_OP_WRITE, fd, buffer.data(), static_cast<uint32_t>(buffer.size()), offset);
+    }
+
+    Uring::Awaiter Uring::readFixed(const unsigned fileIndex, const size_t bufferIndex,
+                                    const uint32_t length, const uint64_t offset) noexcept
+    {
+        Awaiter awaiter = make(*this, IORING_OP_READ_FIXED, static_cast<int>(fileIndex),
+                               buffer(bufferIndex).data(), length, offset);
+        awaiter.request.flags = IOSQE_FIXED_FILE;
+        awaiter.request.buf_index = static_cast<uint16_t>(bufferIndex);
+        return awaiter;
+    }
+
+    Uring::Awaiter Uring::writeFixed(const unsigned fileIndex, const size_t bufferIndex,
+                                     const uint32_t length, const uint64_t offset) noexcept
+    {
+        Awaiter awaiter = make(*this, IORING_OP_WRITE_FIXED, static_cast<int>(fileIndex),
+                               buffer(bufferIndex).data(), length, offset);
+        awaiter.request.flags = IOSQE_FIXED_FILE;
+        awaiter.request.buf_index = static_cast<uint16_t>(bufferIndex);
+        return awaiter;
+    }
+
+    Uring::Awaiter Uring::accept(const int fd) noexcept
+    {
+        Awaiter awaiter = make(*this, IORING_OP_ACCEPT, fd, nullptr, 0, 0);
+        awaiter.request.accept_flags = SOCK_CLOEXEC;
+        return awaiter;
+    }
+
+    Uring::Awaiter Uring::fsync(const int fd, const bool dataOnly) noexcept
+    {
+        Awaiter awaiter = make(*this, IORING_OP_FSYNC, fd, nullptr, 0, 0);
+        awaiter.request.fsync_flags = dataOnly ? IORING_FSYNC_DATASYNC : 0;
+        return awaiter;
+    }
+
+    Uring::Awaiter Uring::timeout(const std::chrono::nanoseconds duration) noexcept
+    {
+        /** len = 1 timespec, off = 0: complete on time only, not after N other completions **/
+        Awaiter awaiter = make(*this, IORING_OP_TIMEOUT, -1, nullptr, 1, 0);
+        awaiter.timeout.tv_sec = duration.count() / 1'000'000'000;
+        awaiter.timeout.tv_nsec = duration.count() % 1'000'000'000;
+        return awaiter;
+    }
+}
@@ -0,0 +1,182 @@
+/**============================================================================
+Name        : Uring.h
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : io_uring event loop: awaitable read/write/accept/timeout/fsync
+============================================================================**/
+
+#ifndef CPPCOROUTINES_URING_H
+#define CPPCOROUTINES_URING_H
+
+#include <cerrno>
+#include <chrono>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <span>
+#include <vector>
+
+#include <linux/io_uring.h>
+
+namespace StdCoroutines::Runtime
+{
+    /**
+     * Completion based loop on raw io_uring syscalls (no liburing). Awaiting an operation only
+     * fills an SQE: everything queued during one loop iteration goes to the kernel with the
+     * next io_uring_enter(), together with the wait for completions - one syscall per
+     * iteration instead of one per operation. With SQPOLL a kernel thread picks the SQEs up
+     * and the loop enters the kernel only to sleep when no completion is pending.
+     * Single threaded: operations must be awaited from coroutines resumed by run().
+     * Results follow the kernel convention: >= 0 on success, -errno on failure.
+    **/
+    class Uring
+    {
+    public:
+
+        struct Options
+        {
+            unsigned entries { 256 };
+            bool sqPoll { false };
+            std::chrono::milliseconds sqPollIdle { 100 };
+        };
+
+        struct Stats
+        {
+            uint64_t submitted { 0 };
+            uint64_t completed { 0 };
+            uint64_t enterCalls { 0 };
+        };
+
+        /** Offset meaning 'the current file position' (and the only valid one for sockets and pipes) **/
+        static constexpr uint64_t currentPosition { ~uint64_t { 0 } };
+
+        struct Awaiter
+        {
+            Uring& ring;
+            io_uring_sqe request {};
+            __kernel_timespec timeout {};
+            std::coroutine_handle<> continuation {};
+            int32_t result { 0 };
+
+            [[nodiscard]]
+            bool await_ready() const noexcept {
+                /** TRUE ==> await_resume() or in case FALSE ==> await_suspend() will be called **/
+                return false;
+            }
+
+            void await_suspend(std::coroutine_handle<> hInputCoro);
+
+            [[nodiscard]]
+            int32_t await_resume() const noexcept {
+                /** An expired timeout is its normal completion, not an error **/
+                return (IORING_OP_TIMEOUT == request.opcode && -ETIME == result) ? 0 : result;
+            }
+        };
+
+    private:
+
+        int ringFd { -1 };
+        Options options;
+
+        /** Rings and SQE array shared with the kernel (single mmap when the kernel supports it) **/
+        void* sqRing { nullptr };
+        void* cqRing { nullptr };
+        size_t sqRingSize { 0 };
+        size_t cqRingSize { 0 };
+        io_uring_sqe* sqes { nullptr };
+        size_t sqesSize { 0 };
+
+        unsigned* sqHead { nullptr };
+        unsigned* sqTail { nullptr };
+        unsigned* sqFlags { nullptr };
+        unsigned sqMask { 0 };
+        unsigned sqEntries { 0 };
+
+        unsigned* cqHead { nullptr };
+        unsigned* cqTail { nullptr };
+        unsigned cqMask { 0 };
+        io_uring_cqe* cqes { nullptr };
+
+        /** SQEs filled but not yet handed over with io_uring_enter() **/
+        unsigned unsubmitted { 0 };
+        size_t inFlight { 0 };
+        bool stopping { false };
+        Stats statistics;
+
+        std::vector<int> files;
+        std::unique_ptr<char, void(*)(void*)> bufferArena { nullptr, &std::free };
+        size_t bufferSize { 0 };
+        size_t buffersCount { 0 };
+
+        [[nodiscard]]
+        io_uring_sqe* acquire();
+
+        void enter(unsigned toSubmit, unsigned minComplete);
+        void reap();
+
+        static Awaiter make(Uring& ring, uint8_t opcode, int fd, const void* address, uint32_t length, uint64_t offset) noexcept;
+
+    public:
+
+        explicit Uring(const Options& options);
+        Uring(): Uring(Options {}) {}
+        ~Uring();
+
+        Uring(const Uring&) = delete;
+        Uring& operator=(const Uring&) = delete;
+
+        /** Runs until stop() is called or nothing is in flight any more **/
+        void run();
+
+        /** From a coroutine running on the loop **/
+        void stop() noexcept {
+            stopping = true;
+        }
+
+        [[nodiscard]]
+        const Stats& stats() const noexcept {
+            return statistics;
+        }
+
+        /** Registered files: later addressed by their index in 'fds' with the *Fixed operations **/
+        void registerFiles(std::span<const int> fds);
+
+        /** 'count' page aligned buffers of 'size' bytes pinned once for the *Fixed operations **/
+        void registerBuffers(size_t count, size_t size);
+
+        [[nodiscard]]
+        std::span<char> buffer(size_t bufferIndex) const noexcept {
+            return { bufferArena.get() + bufferIndex * bufferSize, bufferSize };
+        }
+
+        [[nodiscard]]
+        Awaiter read(int fd, std::span<char> buffer, uint64_t offset = currentPosition) noexcept;
+
+        [[nodiscard]]
+        Awaiter write(int fd, std::span<const char> buffer, uint64_t offset = currentPosition) noexcept;
+
+        /** Registered file, registered buffer: no per operation file table or page pinning work **/
+        [[nodiscard]]
+        Awaiter readFixed(unsigned fileIndex, size_t bufferIndex, uint32_t length, uint64_t offset = currentPosition) noexcept;
+
+        [[nodiscard]]
+        Awaiter writeFixed(unsigned fileIndex, size_t bufferIndex, uint32_t length, uint64_t offset = currentPosition) noexcept;
+
+        /** Result: the accepted descriptor **/
+        [[nodiscard]]
+        Awaiter accept(int fd) noexcept;
+
+        [[nodiscard]]
+        Awaiter fsync(int fd, bool dataOnly = false) noexcept;
+
+        /** Result: 0 once 'duration' has passed **/
+        [[nodiscard]]
+        Awaiter timeout(std::chrono::nanoseconds duration) noexcept;
+    };
+}
+
+#endif //CPPCOROUTINES_URING_H
@@ -0,0 +1,126 @@
+/**============================================================================
+Name        : WaitEvent.cpp
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Futex / eventfd based thread wakeup primitive
+============================================================================**/
+
+#include "WaitEvent.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <ctime>
+#include <linux/futex.h>
+#include <sys/eventfd.h>
+#include <sys/syscall.h>
+#include <system_error>
+#include <unistd.h>
+
+namespace
+{
+    long futex(std::atomic<uint32_t>& word, const int op, const uint32_t value,
+               const timespec* timeout = nullptr, const uint32_t bitset = 0)
+    {
+        return ::syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), op | FUTEX_PRIVATE_FLAG,
+                         value, timeout, nullptr, bitset);
+    }
+}
+
+namespace StdCoroutines::Runtime
+{
+    WaitEvent::WaitEvent(): eventFd { ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC) }
+    {
+        if (eventFd < 0) {
+            throw std::system_error(errno, std::system_category(), "eventfd");
+        }
+    }
+
+    WaitEvent::~WaitEvent()
+    {
+        ::close(eventFd);
+    }
+
+    void WaitEvent::notify() noexcept
+    {
+        switch (state.exchange(Notified, std::memory_order_acq_rel))
+        {
+            case ParkedFutex:
+                futex(state, FUTEX_WAKE, 1);
+                break;
+            case ParkedPoll: {
+                const uint64_t one { 1 };
+                [[maybe_unused]] const auto bytes = ::write(eventFd, &one, sizeof(one));
+                break;
+            }
+            default:
+                break;
+        }
+    }
+
+    void WaitEvent::wait() noexcept
+    {
+        waitFor(std::chrono::nanoseconds::max());
+    }
+
+    bool WaitEvent::waitFor(const std::chrono::nanoseconds timeout) noexcept
+    {
+        if (Notified == state.exchange(Idle, std::memory_order_acquire)) {
+            return true;
+        }
+
+        /** Absolute CLOCK_MONOTONIC deadline: a retry after a spurious wakeup or EINTR doesn't restart the timeout **/
+        timespec deadline {};
+        const timespec* deadlinePtr { nullptr };
+        if (timeout != std::chrono::nanoseconds::max())
+        {
+            const auto remaining = std::max(timeout, std::chrono::nanoseconds::zero());
+            const auto seconds = std::chrono::duration_cast<std::chrono::seconds>(remaining);
+            ::clock_gettime(CLOCK_MONOTONIC, &deadline);
+            deadline.tv_sec += seconds.count();
+            deadline.tv_nsec += (remaining - seconds).count();
+            if (deadline.tv_nsec >= 1'000'000'000) {
+                ++deadline.tv_sec;
+                deadline.tv_nsec -= 1'000'000'000;
+            }
+            deadlinePtr = &deadline;
+        }
+
+        uint32_t expected { Idle };
+        if (state.compare_exchange_strong(expected, ParkedFutex, std::memory_order_acq_rel))
+        {
+            /** Spurious wakeups are fine, the state tells whether we were notified **/
+            while (ParkedFutex == state.load(std::memory_order_acquire))
+            {
+                if (futex(state, FUTEX_WAIT_BITSET, ParkedFutex, deadlinePtr, FUTEX_BITSET_MATCH_ANY) < 0 && ETIMEDOUT == errno) {
+                    expected = ParkedFutex;
+                    if (state.compare_exchange_strong(expected, Idle, std::memory_order_acq_rel)) {
+                        return false;
+                    }
+                    break;
+                }
+            }
+        }
+        state.store(Idle, std::memory_order_release);
+        return true;
+    }
+
+    bool WaitEvent::prepareWait() noexcept
+    {
+        uint32_t expected { Idle };
+        if (state.compare_exchange_strong(expected, ParkedPoll, std::memory_order_acq_rel)) {
+            return true;
+        }
+        /** Already notified **/
+        return ParkedPoll == expected;
+    }
+
+    void WaitEvent::consume() noexcept
+    {
+        uint64_t value { 0 };
+        [[maybe_unused]] const auto bytes = ::read(eventFd, &value, sizeof(value));
+        state.store(Idle, std::memory_order_release);
+    }
+}
@@ -0,0 +1,68 @@
+/**============================================================================
+Name        : WaitEvent.h
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Futex / eventfd based thread wakeup primitive
+============================================================================**/
+
+#ifndef CPPCOROUTINES_WAITEVENT_H
+#define CPPCOROUTINES_WAITEVENT_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace StdCoroutines::Runtime
+{
+    /**
+     * Single consumer, any number of producers. The consumer either parks on a futex (wait())
+     * or adds fd() to its epoll set (prepareWait() / consume()). notify() enters the kernel only
+     * when the consumer is actually parked, so a busy consumer costs the producer one atomic exchange.
+    **/
+    class WaitEvent
+    {
+        enum State : uint32_t
+        {
+            Idle,
+            Notified,
+            ParkedFutex,
+            ParkedPoll
+        };
+
+        std::atomic<uint32_t> state { Idle };
+        int eventFd { -1 };
+
+    public:
+
+        WaitEvent();
+        ~WaitEvent();
+
+        WaitEvent(const WaitEvent&) = delete;
+        WaitEvent& operator=(const WaitEvent&) = delete;
+
+        void notify() noexcept;
+
+        /** Blocks until notify() is called. Returns immediately if a notification is pending **/
+        void wait() noexcept;
+
+        /** Returns false on timeout **/
+        bool waitFor(std::chrono::nanoseconds timeout) noexcept;
+
+        /** For epoll loops: readable whenever a notification arrives while prepareWait() is in effect **/
+        [[nodiscard]]
+        int fd() const noexcept {
+            return eventFd;
+        }
+
+        /** Call before epoll_wait(). Returns false if a notification is already pending - don't block then **/
+        [[nodiscard]]
+        bool prepareWait() noexcept;
+
+        /** Call after epoll_wait() returned (for any reason) **/
+        void consume() noexcept;
+    };
+}
+
+#endif //CPPCOROUTINES_WAITEVENT_H
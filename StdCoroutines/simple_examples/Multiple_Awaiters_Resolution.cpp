@@ -8,6 +8,9 @@ Description : Simple Coroutine Waitable
 ============================================================================**/
 
 #include "SimpleCoroutines.h"
+#include "runtime/AsyncEvent.h"
+#include "runtime/Tracing.h"
+
 #include <iostream>
 #include <chrono>
 #include <thread>
@@ -53,12 +56,15 @@ or other asynchronous tasks into your coroutine workflow.
 
 namespace
 {
+    namespace Trace = StdCoroutines::Runtime::Trace;
+
     auto tid() { return std::this_thread::get_id();}
     auto time() { return Utilities::getCurrentTime();}
 
+    /** A handle to a real event: copyable, so await_transform() can still pick the awaiter by type **/
     struct Event
     {
-        std::chrono::milliseconds duration;
+        StdCoroutines::Runtime::AsyncManualResetEvent& event;
     };
 
 
@@ -103,10 +109,10 @@ namespace
     struct EventAwaiter
     {
         CoroType::promise_type& promise;
-        Event event {};
+        StdCoroutines::Runtime::AsyncManualResetEvent::Awaiter awaiter;
 
-        EventAwaiter(CoroType::promise_type& promise, Event ent) : promise { promise }, event { ent } {
-            std::println("[{}] [{}] EventAwaiter::EventAwaiter({})", tid(), time(), event.duration.count());
+        EventAwaiter(CoroType::promise_type& promise, const Event ent) : promise { promise }, awaiter { ent.event } {
+            std::println("[{}] [{}] EventAwaiter::EventAwaiter()", tid(), time());
         }
 
         bool await_ready() noexcept
@@ -114,21 +120,20 @@ namespace
             std::println("[{}] [{}] EventAwaiter::await_ready()", tid(), time());
 
             /** TRUE ==> await_resume() or in case FALSE ==> await_suspend() will be called **/
-            return false;
+            return awaiter.await_ready();
         }
 
-        void await_suspend(std::coroutine_handle<typename CoroType::promise_type> hInputCoro) noexcept
+        bool await_suspend(std::coroutine_handle<typename CoroType::promise_type> hInputCoro) noexcept
         {
             std::println("[{}] [{}] EventAwaiter::await_suspend()", tid(), time());
-            std::jthread thread([&hInputCoro, this]() {
-                std::this_thread::sleep_for(event.duration);
-                hInputCoro.promise().data = 1;
-                hInputCoro.resume();
-            });
+
+            /** Parks the coroutine in the event: set() resumes it, no thread per waiter **/
+            return awaiter.await_suspend(hInputCoro);
         }
 
         void await_resume() noexcept {
             std::println("[{}] [{}] EventAwaiter::await_resume()", tid(), time());
+            promise.data = 1;
         }
     };
 }
@@ -144,16 +149,19 @@ namespace
             TaskPromise get_return_object()
             {
                 std::println("[{}] [{}] \tpromise_type::get_return_object()", tid(), time());
-                return TaskPromise {std::coroutine_handle<promise_type>::from_promise(*this)};
+                const auto handle = std::coroutine_handle<promise_type>::from_promise(*this);
+                Trace::record(handle, Trace::Event::Created, "createCoroutine");
+                return TaskPromise { handle };
             }
 
-            std::suspend_always initial_suspend() {
+            Trace::Traced<std::suspend_always> initial_suspend() {
                 std::println("[{}] [{}] \tpromise_type::initial_suspend()", tid(), time());
-                return {};
+                return Trace::traced(std::suspend_always{}, "initial_suspend");
             }
 
             std::suspend_always final_suspend() noexcept {
                 std::println("[{}] [{}] \tpromise_type::final_suspend()", tid(), time());
+                Trace::record(std::coroutine_handle<promise_type>::from_promise(*this), Trace::Event::Finished);
                 return {};
             }
 
@@ -166,12 +174,12 @@ namespace
                 std::terminate();
             }
 
-            DurationAwaiter<TaskPromise> await_transform(const std::chrono::milliseconds timeout) noexcept {
-                return DurationAwaiter<TaskPromise>(*this, timeout);
+            Trace::Traced<DurationAwaiter<TaskPromise>> await_transform(const std::chrono::milliseconds timeout) noexcept {
+                return Trace::traced(DurationAwaiter<TaskPromise>(*this, timeout), "DurationAwaiter");
             }
 
-            EventAwaiter<TaskPromise> await_transform(const Event& event) noexcept {
-                return EventAwaiter<TaskPromise>(*this, event);
+            Trace::Traced<EventAwaiter<TaskPromise>> await_transform(const Event& event) noexcept {
+                return Trace::traced(EventAwaiter<TaskPromise>(*this, event), "EventAwaiter");
             }
         };
 
@@ -200,6 +208,29 @@ namespace
         result = promise.handle.promise().data;
         std::println("[{}] [{}] main(2). result = {}", tid(), time(), result);
     }
+
+    /** Two coroutines wait for the same event: one set() from one thread resumes both **/
+    void testEvent()
+    {
+        StdCoroutines::Runtime::AsyncManualResetEvent ready;
+
+        std::println("[{}] [{}] main(0)",tid(), time());
+        TaskPromise first = createCoroutine(Event { ready });
+        TaskPromise second = createCoroutine(Event { ready });
+        first.handle.resume();
+        second.handle.resume();
+        std::println("[{}] [{}] main(1). results = {}, {}", tid(), time(),
+                     first.handle.promise().data, second.handle.promise().data);
+
+        std::jthread setter([&ready] {
+            std::this_thread::sleep_for(std::chrono::seconds(1u));
+            ready.set();
+        });
+        setter.join();
+
+        std::println("[{}] [{}] main(2). results = {}, {}", tid(), time(),
+                     first.handle.promise().data, second.handle.promise().data);
+    }
 }
 
 /**
@@ -212,13 +243,19 @@ namespace
 
 void StdCoroutines::Simple::Multiple_Awaiters_Resolution::TestAll()
 {
+    Trace::start();
+
     /** Will use DurationAwaiter **/
     test(std::chrono::seconds(1u));
 
     std::cout << std::string(180,'=') << std::endl;
 
     /** Will use EventAwaiter **/
-    test(Event {std::chrono::seconds(1u)});
+    testEvent();
+
+    /** Open in ui.perfetto.dev: the resume after the timeout is shown as a migration to the awaiter thread **/
+    Trace::stop();
+    Trace::exportChromeTrace("Multiple_Awaiters_Resolution.trace.json");
 }
 
 /**
@@ -236,17 +273,27 @@ void StdCoroutines::Simple::Multiple_Awaiters_Resolution::TestAll()
 [139961643177728] [2025-03-02 14:29:50.834236] 	promise_type::final_suspend()
 [139961643191168] [2025-03-02 14:29:50.834380] main(2). result = 1
 ====================================================================================================================================================================================
-[139961643191168] [2025-03-02 14:29:50.834517] main(0)
-[139961643191168] [2025-03-02 14:29:50.834531] 	promise_type::get_return_object()
-[139961643191168] [2025-03-02 14:29:50.834543] 	promise_type::initial_suspend()
-[139961643191168] [2025-03-02 14:29:50.834556] main(1). result = 0
-[139961643191168] [2025-03-02 14:29:50.834567] createCoroutine() step 1
-[139961643191168] [2025-03-02 14:29:50.834578] EventAwaiter::EventAwaiter(3000)
-[139961643191168] [2025-03-02 14:29:50.834595] EventAwaiter::await_ready()
-[139961643191168] [2025-03-02 14:29:50.834604] EventAwaiter::await_suspend()
-[139961643177728] [2025-03-02 14:29:53.835200] EventAwaiter::await_resume()
-[139961643177728] [2025-03-02 14:29:53.835265] createCoroutine() step 2
-[139961643177728] [2025-03-02 14:29:53.835276] 	promise_type::return_void()
-[139961643177728] [2025-03-02 14:29:53.835286] 	promise_type::final_suspend()
-[139961643191168] [2025-03-02 14:29:53.835431] main(2). result = 1
+[139870341588928] [2026-10-18 18:06:18.646918] main(0)
+[139870341588928] [2026-10-18 18:06:18.646921] 	promise_type::get_return_object()
+[139870341588928] [2026-10-18 18:06:18.646923] 	promise_type::initial_suspend()
+[139870341588928] [2026-10-18 18:06:18.646925] 	promise_type::get_return_object()
+[139870341588928] [2026-10-18 18:06:18.646927] 	promise_type::initial_suspend()
+[139870341588928] [2026-10-18 18:06:18.646929] createCoroutine() step 1
+[139870341588928] [2026-10-18 18:06:18.646930] EventAwaiter::EventAwaiter()
+[139870341588928] [2026-10-18 18:06:18.646932] EventAwaiter::await_ready()
+[139870341588928] [2026-10-18 18:06:18.646934] EventAwaiter::await_suspend()
+[139870341588928] [2026-10-18 18:06:18.646935] createCoroutine() step 1
+[139870341588928] [2026-10-18 18:06:18.646937] EventAwaiter::EventAwaiter()
+[139870341588928] [2026-10-18 18:06:18.646938] EventAwaiter::await_ready()
+[139870341588928] [2026-10-18 18:06:18.646940] EventAwaiter::await_suspend()
+[139870341588928] [2026-10-18 18:06:18.646941] main(1). results = 0, 0
+[139870334076608] [2026-10-18 18:06:19.648515] EventAwaiter::await_resume()
+[139870334076608] [2026-10-18 18:06:19.648551] createCoroutine() step 2
+[139870334076608] [2026-10-18 18:06:19.648553] 	promise_type::return_void()
+[139870334076608] [2026-10-18 18:06:19.648554] 	promise_type::final_suspend()
+[139870334076608] [2026-10-18 18:06:19.648557] EventAwaiter::await_resume()
+[139870334076608] [2026-10-18 18:06:19.648558] createCoroutine() step 2
+[139870334076608] [2026-10-18 18:06:19.648559] 	promise_type::return_void()
+[139870334076608] [2026-10-18 18:06:19.648561] 	promise_type::final_suspend()
+[139870341588928] [2026-10-18 18:06:19.648663] main(2). results = 1, 1
 **/
\ No newline at end of file
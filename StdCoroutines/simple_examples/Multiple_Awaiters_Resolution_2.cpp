@@ -8,6 +8,7 @@ Description : Simple Coroutine Waitable
 ============================================================================**/
 
 #include "SimpleCoroutines.h"
+#include "runtime/AsyncEvent.h"
 #include <iostream>
 #include <chrono>
 #include <thread>
@@ -56,9 +57,10 @@ namespace
     auto tid() { return std::this_thread::get_id();}
     auto time() { return Utilities::getCurrentTime();}
 
+    /** A handle to a real event: copyable, so await_transform() can still pick the awaiter by type **/
     struct Event
     {
-        std::chrono::milliseconds duration;
+        StdCoroutines::Runtime::AsyncManualResetEvent& event;
     };
 
     // TODO: Concepts ??? to check CoroType::promise_type
@@ -99,10 +101,11 @@ namespace
     template<typename CoroType>
     struct EventAwaiter
     {
-        Event event {};
+        StdCoroutines::Runtime::AsyncManualResetEvent::Awaiter awaiter;
+        std::coroutine_handle<typename CoroType::promise_type> hInputCoro {};
 
-        explicit EventAwaiter(const Event ent): event { ent } {
-            std::println("[{}] [{}] EventAwaiter::EventAwaiter({})", tid(), time(), event.duration.count());
+        explicit EventAwaiter(const Event ent): awaiter { ent.event } {
+            std::println("[{}] [{}] EventAwaiter::EventAwaiter()", tid(), time());
         }
 
         bool await_ready() noexcept
@@ -110,21 +113,21 @@ namespace
             std::println("[{}] [{}] EventAwaiter::await_ready()", tid(), time());
 
             /** TRUE ==> await_resume() or in case FALSE ==> await_suspend() will be called **/
-            return false;
+            return awaiter.await_ready();
         }
 
-        void await_suspend(std::coroutine_handle<typename CoroType::promise_type> hInputCoro) noexcept
+        bool await_suspend(std::coroutine_handle<typename CoroType::promise_type> hInputCoro) noexcept
         {
             std::println("[{}] [{}] EventAwaiter::await_suspend()", tid(), time());
-            std::jthread thread([&hInputCoro, this]() {
-                std::this_thread::sleep_for(event.duration);
-                hInputCoro.promise().data = 1;
-                hInputCoro.resume();
-            });
+            this->hInputCoro = hInputCoro;
+
+            /** Parks the coroutine in the event: set() resumes it, no thread per waiter **/
+            return awaiter.await_suspend(hInputCoro);
         }
 
         void await_resume() noexcept {
             std::println("[{}] [{}] EventAwaiter::await_resume()", tid(), time());
+            hInputCoro.promise().data = 1;
         }
     };
 }
@@ -196,6 +199,29 @@ namespace
         result = promise.handle.promise().data;
         std::println("[{}] [{}] main(2). result = {}", tid(), time(), result);
     }
+
+    /** Two coroutines wait for the same event: one set() from one thread resumes both **/
+    void testEvent()
+    {
+        StdCoroutines::Runtime::AsyncManualResetEvent ready;
+
+        std::println("[{}] [{}] main(0)",tid(), time());
+        TaskPromise first = createCoroutine(Event { ready });
+        TaskPromise second = createCoroutine(Event { ready });
+        first.handle.resume();
+        second.handle.resume();
+        std::println("[{}] [{}] main(1). results = {}, {}", tid(), time(),
+                     first.handle.promise().data, second.handle.promise().data);
+
+        std::jthread setter([&ready] {
+            std::this_thread::sleep_for(std::chrono::seconds(1u));
+            ready.set();
+        });
+        setter.join();
+
+        std::println("[{}] [{}] main(2). results = {}, {}", tid(), time(),
+                     first.handle.promise().data, second.handle.promise().data);
+    }
 }
 
 /**
@@ -217,7 +243,7 @@ void StdCoroutines::Simple::Multiple_Awaiters_Resolution_2::TestAll()
     std::cout << std::string(180,'=') << std::endl;
 
     /** Will use EventAwaiter **/
-    test(Event {std::chrono::seconds(1u)});
+    testEvent();
 }
 
 /**
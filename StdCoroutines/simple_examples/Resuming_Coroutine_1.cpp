@@ -8,6 +8,7 @@ Description : Simple Coroutine Waitable
 ============================================================================**/
 
 #include "SimpleCoroutines.h"
+#include "runtime/AsyncEvent.h"
 #include <thread>
 
 namespace
@@ -18,9 +19,7 @@ namespace
 
 namespace
 {
-    struct Event {
-        // you could put a description of a specific event in here
-    };
+    using Event = StdCoroutines::Runtime::AsyncManualResetEvent;
 
     struct TaskPromise
     {
@@ -66,12 +65,6 @@ namespace
                 std::println("[{}] [{}] \t\tpromise_type::unhandled_exception()", tid(), time());
                 std::terminate();
             }
-
-            std::suspend_always await_transform(Event) noexcept
-            {   // you could write code here that adjusted the main program's data structures
-                // to ensure the coroutine would be resumed at the right time
-                return {};
-            }
         };
 
         explicit TaskPromise(const coroutine_handle& handle) : handle { handle }
@@ -85,24 +78,22 @@ namespace
                 handle.destroy();
         }
 
-        void resume() const {
-            handle.resume();
-        }
-
         coroutine_handle handle;
     };
 
-    TaskPromise makeCoroutine()
+    /** The event keeps the suspended coroutine and resumes it from set(): no handle juggling in main() **/
+    TaskPromise makeCoroutine(Event& event)
     {
         std::println("[{}] [{}] we're about to suspend this coroutine", tid(), time());
-        co_await Event{};
+        co_await event;
         std::println("[{}] [{}] we've successfully resumed the coroutine", tid(), time());
     }
 }
 
 void StdCoroutines::Simple::Resuming_Coroutine_1::TestAll()
 {
-    TaskPromise coro = makeCoroutine();
+    Event event;
+    TaskPromise coro = makeCoroutine(event);
     std::println("[{}] [{}] we're back in main()", tid(), time());
-    coro.resume();
+    event.set();
 }
@@ -0,0 +1,278 @@
+/**============================================================================
+Name        : Benchmark_Comparison.cpp
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : tinycoro_bench [--json] [filter]: identical workloads on
+              tinycoro::Scheduler and on the StdCoroutines runtime
+============================================================================**/
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <sys/resource.h>
+
+#include "benchmarks/Benchmark.h"
+#include "runtime/AsyncEvent.h"
+#include "runtime/AsyncMutex.h"
+#include "runtime/Task.h"
+#include "runtime/ThreadPool.h"
+#include "runtime/TimerService.h"
+
+#include <tinycoro/tinycoro_all.h>
+
+namespace
+{
+    using namespace std::chrono_literals;
+    using namespace StdCoroutines::Runtime;
+    using StdCoroutines::Benchmarks::Suite;
+    using StdCoroutines::Benchmarks::doNotOptimize;
+
+    /** Children per fan-out, tasks hammering the mutex, sleepers in the timer workload **/
+    constexpr size_t fanOut { 1'000 };
+    constexpr size_t contenders { 64 };
+    constexpr size_t sleepers { 1'000 };
+    constexpr auto sleepDuration { 10ms };
+
+    /** Same amount of work in every fan-out child **/
+    int64_t childWork(const int64_t seed)
+    {
+        int64_t value { seed };
+        for (int i = 0; i < 64; ++i) {
+            value = value * 6364136223846793005LL + 1442695040888963407LL;
+        }
+        return value;
+    }
+
+    std::chrono::microseconds cpuTime()
+    {
+        rusage usage {};
+        ::getrusage(RUSAGE_SELF, &usage);
+        return std::chrono::seconds { usage.ru_utime.tv_sec + usage.ru_stime.tv_sec } +
+               std::chrono::microseconds { usage.ru_utime.tv_usec + usage.ru_stime.tv_usec };
+    }
+
+    void FanOutFanIn(Suite& suite, tinycoro::Scheduler& scheduler, ThreadPool& pool)
+    {
+        suite.run("fan_out_fan_in/tinycoro", [&scheduler](const uint64_t ops) {
+            std::atomic<int64_t> sum { 0 };
+            for (uint64_t done = 0; done < ops; done += fanOut)
+            {
+                std::vector<tinycoro::Task<void>> tasks;
+                tasks.reserve(fanOut);
+                for (size_t idx = 0; idx < fanOut; ++idx) {
+                    tasks.push_back([](std::atomic<int64_t>& total, const int64_t seed) -> tinycoro::Task<void> {
+                        total.fetch_add(childWork(seed), std::memory_order_relaxed);
+                        co_return;
+                    }(sum, static_cast<int64_t>(idx)));
+                }
+                tinycoro::GetAll(scheduler, tasks);
+            }
+            doNotOptimize(sum.load());
+        });
+
+        suite.run("fan_out_fan_in/runtime", [&pool](const uint64_t ops) {
+            std::atomic<int64_t> sum { 0 };
+            for (uint64_t done = 0; done < ops; done += fanOut)
+            {
+                std::vector<Task<>> tasks;
+                tasks.reserve(fanOut);
+                for (size_t idx = 0; idx < fanOut; ++idx) {
+                    tasks.push_back([](ThreadPool& workers, std::atomic<int64_t>& total, const int64_t seed) -> Task<> {
+                        co_await workers.schedule();
+                        total.fetch_add(childWork(seed), std::memory_order_relaxed);
+                    }(pool, sum, static_cast<int64_t>(idx)));
+                }
+                syncWait(whenAll(std::move(tasks)));
+            }
+            doNotOptimize(sum.load());
+        });
+    }
+
+    void PingPong(Suite& suite, tinycoro::Scheduler& scheduler, ThreadPool& pool)
+    {
+        suite.run("ping_pong/tinycoro", [&scheduler](const uint64_t ops) {
+            tinycoro::AutoEvent ping, pong;
+            auto player = [](tinycoro::AutoEvent& wait, tinycoro::AutoEvent& signal,
+                             const uint64_t rounds, const bool serves) -> tinycoro::Task<void> {
+                for (uint64_t i = 0; i < rounds; ++i)
+                {
+                    if (serves) {
+                        signal.Set();
+                        co_await wait;
+                    } else {
+                        co_await wait;
+                        signal.Set();
+                    }
+                }
+            };
+            tinycoro::GetAll(scheduler, player(pong, ping, ops, true), player(ping, pong, ops, false));
+        });
+
+        suite.run("ping_pong/runtime", [&pool](const uint64_t ops) {
+            AsyncAutoResetEvent ping { false, &pool }, pong { false, &pool };
+            auto player = [](ThreadPool& workers, AsyncAutoResetEvent& wait, AsyncAutoResetEvent& signal,
+                             const uint64_t rounds, const bool serves) -> Task<> {
+                co_await workers.schedule();
+                for (uint64_t i = 0; i < rounds; ++i)
+                {
+                    if (serves) {
+                        signal.set();
+                        co_await wait;
+                    } else {
+                        co_await wait;
+                        signal.set();
+                    }
+                }
+            };
+            std::vector<Task<>> players;
+            players.push_back(player(pool, pong, ping, ops, true));
+            players.push_back(player(pool, ping, pong, ops, false));
+            syncWait(whenAll(std::move(players)));
+        });
+    }
+
+    void MutexContention(Suite& suite, tinycoro::Scheduler& scheduler, ThreadPool& pool)
+    {
+        suite.run("mutex_contention/tinycoro", [&scheduler](const uint64_t ops) {
+            tinycoro::Mutex mutex;
+            uint64_t counter { 0 };
+            const uint64_t perTask = std::max<uint64_t>(1, ops / contenders);
+
+            std::vector<tinycoro::Task<void>> tasks;
+            tasks.reserve(contenders);
+            for (size_t idx = 0; idx < contenders; ++idx) {
+                tasks.push_back([](tinycoro::Mutex& lockable, uint64_t& shared, const uint64_t count) -> tinycoro::Task<void> {
+                    for (uint64_t i = 0; i < count; ++i) {
+                        auto lock = co_await lockable;
+                        ++shared;
+                    }
+                }(mutex, counter, perTask));
+            }
+            tinycoro::GetAll(scheduler, tasks);
+            doNotOptimize(counter);
+        });
+
+        suite.run("mutex_contention/runtime", [&pool](const uint64_t ops) {
+            AsyncMutex mutex { pool };
+            uint64_t counter { 0 };
+            const uint64_t perTask = std::max<uint64_t>(1, ops / contenders);
+
+            std::vector<Task<>> tasks;
+            tasks.reserve(contenders);
+            for (size_t idx = 0; idx < contenders; ++idx) {
+                tasks.push_back([](ThreadPool& workers, AsyncMutex& lockable, uint64_t& shared, const uint64_t count) -> Task<> {
+                    co_await workers.schedule();
+                    for (uint64_t i = 0; i < count; ++i) {
+                        const AsyncLock lock = co_await lockable.scoped_lock();
+                        ++shared;
+                    }
+                }(pool, mutex, counter, perTask));
+            }
+            syncWait(whenAll(std::move(tasks)));
+            doNotOptimize(counter);
+        });
+    }
+
+    /**
+     * tinycoro has no parking timer in the version we build against, so its side is the
+     * re-queueing sleep from TinyCoro::Examples::SpinningSleep. ns/op is CPU time per sleeper.
+    **/
+    template<typename Run>
+    void measureSleepers(Suite& suite, const std::string_view name, Run run)
+    {
+        if (!suite.enabled(name)) {
+            return;
+        }
+        std::vector<int64_t> latenessUs(sleepers);
+
+        const std::chrono::microseconds cpuBefore = cpuTime();
+        run(latenessUs);
+        const std::chrono::microseconds cpu = cpuTime() - cpuBefore;
+        std::ranges::sort(latenessUs);
+
+        StdCoroutines::Benchmarks::Result result;
+        result.name = std::string { name };
+        result.operations = sleepers;
+        result.nsPerOp = static_cast<double>(cpu.count()) * 1e3 / sleepers;
+        result.extra["late_p50_us"] = static_cast<double>(latenessUs[sleepers / 2]);
+        result.extra["late_p99_us"] = static_cast<double>(latenessUs[sleepers * 99 / 100]);
+        suite.add(std::move(result));
+    }
+
+    void Timers(Suite& suite, tinycoro::Scheduler& scheduler, ThreadPool& pool)
+    {
+        using SteadyClock = std::chrono::steady_clock;
+        const auto lateness = [](const SteadyClock::time_point deadline) {
+            return std::chrono::duration_cast<std::chrono::microseconds>(SteadyClock::now() - deadline).count();
+        };
+
+        measureSleepers(suite, "timers_cpu/tinycoro", [&](std::vector<int64_t>& latenessUs) {
+            std::vector<tinycoro::Task<void>> tasks;
+            tasks.reserve(sleepers);
+            for (int64_t& result: latenessUs) {
+                tasks.push_back([](int64_t& out, auto measure) -> tinycoro::Task<void> {
+                    const auto deadline = SteadyClock::now() + sleepDuration;
+                    while (SteadyClock::now() < deadline) {
+                        co_await std::suspend_always{};
+                    }
+                    out = measure(deadline);
+                }(result, lateness));
+            }
+            tinycoro::GetAll(scheduler, tasks);
+        });
+
+        measureSleepers(suite, "timers_cpu/runtime", [&](std::vector<int64_t>& latenessUs) {
+            std::vector<Task<>> tasks;
+            tasks.reserve(sleepers);
+            for (int64_t& result: latenessUs) {
+                tasks.push_back([](ThreadPool& workers, int64_t& out, auto measure) -> Task<> {
+                    const auto deadline = SteadyClock::now() + sleepDuration;
+                    co_await sleep_for(sleepDuration, workers);
+                    out = measure(deadline);
+                }(pool, result, lateness));
+            }
+            syncWait(whenAll(std::move(tasks)));
+        });
+    }
+}
+
+int main([[maybe_unused]] int argc,
+         [[maybe_unused]] char** argv)
+{
+    const std::vector<std::string_view> args(argv + 1, argv + argc);
+
+    bool json { false };
+    std::string_view filter;
+    for (const std::string_view arg: args) {
+        if ("--json" == arg)
+            json = true;
+        else
+            filter = arg;
+    }
+
+    /** Same number of workers on both sides **/
+    const unsigned workers = std::max(2u, std::thread::hardware_concurrency());
+    tinycoro::Scheduler scheduler { workers };
+    ThreadPool pool { workers };
+
+    Suite suite { filter };
+    FanOutFanIn(suite, scheduler, pool);
+    PingPong(suite, scheduler, pool);
+    MutexContention(suite, scheduler, pool);
+    Timers(suite, scheduler, pool);
+
+    if (json) {
+        suite.printJson();
+    } else {
+        suite.printTable();
+        suite.printComparison("tinycoro", "runtime");
+    }
+
+    return EXIT_SUCCESS;
+}
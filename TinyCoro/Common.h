@@ -15,6 +15,9 @@ Description : TinyCoro library tests
 #include <chrono>
 #include <thread>
 
+#include "runtime/Logger.h"
+#include "runtime/ThreadPool.h"
+
 using namespace std::chrono_literals;
 
 constexpr std::osyncstream SyncOut(std::ostream& stream = std::cout)
@@ -24,23 +27,29 @@ constexpr std::osyncstream SyncOut(std::ostream& stream = std::cout)
 
 typedef void (*funcPtr)(void*, int, int);
 
-std::jthread AsyncCallbackAPI(void* userData, funcPtr cb, int i = 43)
+/** Stands for the legacy library's own (bounded) I/O threads: no thread per call **/
+inline StdCoroutines::Runtime::ThreadPool& LegacyLibraryPool()
+{
+    static StdCoroutines::Runtime::ThreadPool pool { 4 };
+    return pool;
+}
+
+inline void AsyncCallbackAPI(void* userData, funcPtr cb, int i = 43)
 {
-    return std::jthread{[cb, userData, i] {
-        SyncOut() << "  AsyncCallbackAPI... Thread id: " << std::this_thread::get_id() << '\n';
+    LegacyLibraryPool().submit([cb, userData, i] {
+        StdCoroutines::Runtime::Log::info("  AsyncCallbackAPI...");
         std::this_thread::sleep_for(200ms);
         cb(userData, 42, i);
-    }};
+    });
 }
 
 void AsyncCallbackAPIvoid(std::regular_invocable<void*, int> auto cb, void* userData)
 {
-    std::jthread t{[cb, userData] {
-        SyncOut() << "  AsyncCallbackAPI... Thread id: " << std::this_thread::get_id() << '\n';
+    LegacyLibraryPool().submit([cb, userData] {
+        StdCoroutines::Runtime::Log::info("  AsyncCallbackAPI...");
         std::this_thread::sleep_for(200ms);
         cb(userData, 42);
-    }};
-    t.detach();
+    });
 }
 
 
@@ -18,13 +18,19 @@
 #include <format>
 #include <print>
 
+#include <sys/resource.h>
+
 #include "Common.h"
+#include "runtime/CallbackAwaiter.h"
+#include "runtime/Task.h"
+#include "runtime/TimerService.h"
 #include <tinycoro/tinycoro_all.h>
 
 
 namespace TinyCoro::Examples
 {
-    void Sleep(auto& scheduler)
+    /** The original: re-queues itself on the scheduler until the time is up, pinning a worker at 100% CPU **/
+    void SpinningSleep(auto& scheduler)
     {
         auto sleep = [](auto duration) -> tinycoro::Task<int32_t> {
             for (auto start = std::chrono::system_clock::now(); std::chrono::system_clock::now() - start < duration;)
@@ -45,22 +51,135 @@ namespace TinyCoro::Examples
         SyncOut() << "co_return => " << future.get() << '\n';
     }
 
+    /** Parks the task in the timer heap: no worker is busy while it sleeps **/
+    void Sleep()
+    {
+        using namespace StdCoroutines::Runtime;
+
+        auto task = []() -> Task<int32_t> {
+            co_await sleep_for(1s);
+            co_return 42;
+        };
+
+        SyncOut() << "co_return => " << syncWait(task()) << '\n';
+    }
+
+    std::chrono::microseconds CpuTime()
+    {
+        rusage usage {};
+        ::getrusage(RUSAGE_SELF, &usage);
+        return std::chrono::seconds { usage.ru_utime.tv_sec + usage.ru_stime.tv_sec } +
+               std::chrono::microseconds { usage.ru_utime.tv_usec + usage.ru_stime.tv_usec };
+    }
+
+    void PrintSleepers(const std::string_view name, std::vector<int64_t>& latenessUs,
+                       const std::chrono::microseconds cpu, const std::chrono::steady_clock::duration wall)
+    {
+        std::ranges::sort(latenessUs);
+        std::println("{:<28} cpu: {:>6} ms ({:>3.0f}%)  late p50: {:>6} us  p99: {:>6} us  max: {:>6} us", name,
+                     cpu.count() / 1000,
+                     100.0 * static_cast<double>(cpu.count()) /
+                         static_cast<double>(std::chrono::duration_cast<std::chrono::microseconds>(wall).count()),
+                     latenessUs[latenessUs.size() / 2], latenessUs[latenessUs.size() * 99 / 100], latenessUs.back());
+    }
+
+    /** 10k concurrent 100ms sleepers: spinning on tinycoro::Scheduler vs sleep_for() on our pool **/
+    void SleepComparison(auto& scheduler)
+    {
+        using namespace StdCoroutines::Runtime;
+        using SteadyClock = std::chrono::steady_clock;
+
+        constexpr size_t sleepers { 10'000 };
+        constexpr auto duration { 100ms };
+
+        auto lateness = [](const SteadyClock::time_point deadline) {
+            return std::chrono::duration_cast<std::chrono::microseconds>(SteadyClock::now() - deadline).count();
+        };
+
+        {
+            auto spinning = [&lateness, duration]() -> tinycoro::Task<int64_t> {
+                const auto deadline = SteadyClock::now() + duration;
+                while (SteadyClock::now() < deadline) {
+                    co_await std::suspend_always{};
+                }
+                co_return lateness(deadline);
+            };
+
+            const auto cpuBefore = CpuTime();
+            const auto start = SteadyClock::now();
+            std::vector<decltype(scheduler.Enqueue(spinning()))> futures;
+            futures.reserve(sleepers);
+            for (size_t idx = 0; idx < sleepers; ++idx) {
+                futures.push_back(scheduler.Enqueue(spinning()));
+            }
+            std::vector<int64_t> latenessUs;
+            latenessUs.reserve(sleepers);
+            for (auto& future: futures) {
+                latenessUs.push_back(future.get());
+            }
+            PrintSleepers("tinycoro::Scheduler spin", latenessUs, CpuTime() - cpuBefore, SteadyClock::now() - start);
+        }
+
+        {
+            std::vector<int64_t> latenessUs(sleepers);
+            auto parked = [&lateness, duration](int64_t& result) -> Task<> {
+                const auto deadline = SteadyClock::now() + duration;
+                co_await sleep_for(duration);
+                result = lateness(deadline);
+            };
+
+            const auto cpuBefore = CpuTime();
+            const auto start = SteadyClock::now();
+            std::vector<Task<>> tasks;
+            tasks.reserve(sleepers);
+            for (size_t idx = 0; idx < sleepers; ++idx) {
+                tasks.push_back(parked(latenessUs[idx]));
+            }
+            syncWait(whenAll(std::move(tasks)));
+            PrintSleepers("Runtime::sleep_for", latenessUs, CpuTime() - cpuBefore, SteadyClock::now() - start);
+        }
+    }
+
     void MultiTasks(auto& scheduler)
     {
         auto task = []() -> tinycoro::Task<void> {
-            SyncOut() << "  Coro starting..." << "  Thread id : " << std::this_thread::get_id() << '\n';
+            StdCoroutines::Runtime::Log::info("  Coro starting...");
             co_return;
         };
 
         tinycoro::GetAll(scheduler, task(), task(), task());
+        StdCoroutines::Runtime::Log::flush();
         SyncOut() << "GetAll co_return => void" << '\n';
     }
+
+    /** The legacy callback APIs from Common.h as co_await-able operations, continuing on the shared pool **/
+    void CallbackAdapter()
+    {
+        using namespace StdCoroutines::Runtime;
+
+        auto task = []() -> Task<int> {
+            const auto [answer, extra] = co_await fromCallback<int, int>([](void* userData, auto callback) {
+                AsyncCallbackAPI(userData, callback, 7);
+            });
+            const int value = co_await fromCallback<int>([](void* userData, auto callback) {
+                AsyncCallbackAPIvoid(callback, userData);
+            });
+            co_return answer + extra + value;
+        };
+
+        const int result = syncWait(task());
+        StdCoroutines::Runtime::Log::flush();
+        SyncOut() << "fromCallback co_return => " << result << '\n';
+    }
 }
 
 void TinyCoro::TestAll()
 {
     tinycoro::Scheduler scheduler {std::thread::hardware_concurrency()};
 
-    // Examples::Sleep(scheduler);
+    // Examples::SpinningSleep(scheduler);
+    // Examples::Sleep();
+    // Examples::SleepComparison(scheduler);
     Examples::MultiTasks(scheduler);
+    Examples::CallbackAdapter();
 }
@@ -22,6 +22,7 @@ namespace FileUtilities
     int32_t WriteToFile(const std::filesystem::path& filePath,
                         const std::string& text);
 
+    /** Opens the file on every call. For frequent appends from coroutines see StdCoroutines::Runtime::FileAppender **/
     int32_t AppendToFile(const std::filesystem::path& filePath,
                          const std::string& text);
 